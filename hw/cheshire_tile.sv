@@ -15,6 +15,8 @@ module cheshire_tile
   import floo_picobello_noc_pkg::*;
   import picobello_pkg::*;
   import pb_soc_regs_pkg::*;
+  import pb_mem_perf_regs_pkg::*;
+  import pb_noc_perf_regs_pkg::*;
 (
   input logic clk_i,
   input logic rst_ni,
@@ -95,7 +97,14 @@ module cheshire_tile
   output logic [NumMemTiles-1:0] mem_tile_rst_no,
   output logic [NumMemTiles-1:0] mem_tile_clk_en_o,
   output logic fhg_spu_rst_no,
-  output logic fhg_spu_clk_en_o
+  output logic fhg_spu_clk_en_o,
+  // Mem tile performance events
+  input mem_tile_perf_t [NumMemTiles-1:0] mem_tile_perf_i,
+  // NoC performance counters: control of all routers, counter of the local
+  // router and counter selected in all routers
+  output noc_perf_ctrl_t noc_perf_ctrl_o,
+  output noc_perf_data_t noc_perf_data_o,
+  input noc_perf_data_t noc_perf_data_i
 );
 
   ////////////
@@ -151,6 +160,20 @@ module cheshire_tile
   assign router_floo_wide_in[East]  = '0;  // No East port in this tile
   assign router_floo_wide_in[South] = floo_wide_south_i;
 
+  router_perf i_router_perf (
+    .clk_i,
+    .rst_ni,
+    .id_i,
+    .floo_req_in_i  (router_floo_req_in),
+    .floo_req_out_i (router_floo_req_out),
+    .floo_rsp_in_i  (router_floo_rsp_in),
+    .floo_rsp_out_i (router_floo_rsp_out),
+    .floo_wide_in_i (router_floo_wide_in),
+    .floo_wide_out_i(router_floo_wide_out),
+    .ctrl_i         (noc_perf_ctrl_o),
+    .data_o         (noc_perf_data_o)
+  );
+
   /////////////
   // Chimney //
   /////////////
@@ -159,9 +182,21 @@ module cheshire_tile
   axi_narrow_out_rsp_t narrow_out_rsp;
   axi_narrow_in_req_t  narrow_in_req;
   axi_narrow_in_rsp_t  narrow_in_rsp;
+  axi_narrow_in_req_t  noc_narrow_in_req;
+  axi_narrow_in_rsp_t  noc_narrow_in_rsp;
   axi_wide_out_req_t   wide_out_req;
   axi_wide_out_rsp_t   wide_out_rsp;
 
+  l2_interleave #(
+    .axi_req_t(axi_narrow_in_req_t),
+    .axi_rsp_t(axi_narrow_in_rsp_t)
+  ) i_l2_interleave (
+    .slv_req_i(narrow_in_req),
+    .slv_rsp_o(narrow_in_rsp),
+    .mst_req_o(noc_narrow_in_req),
+    .mst_rsp_i(noc_narrow_in_rsp)
+  );
+
   localparam chimney_cfg_t ChimneyCfgN = ChimneyDefaultCfg;
   localparam chimney_cfg_t ChimneyCfgW = set_ports(ChimneyDefaultCfg, 1'b1, 1'b0);
 
@@ -196,8 +231,8 @@ module cheshire_tile
     .test_enable_i       (test_mode_i),
     .sram_cfg_i          ('0),
     .route_table_i       ('0),
-    .axi_narrow_in_req_i (narrow_in_req),
-    .axi_narrow_in_rsp_o (narrow_in_rsp),
+    .axi_narrow_in_req_i (noc_narrow_in_req),
+    .axi_narrow_in_rsp_o (noc_narrow_in_rsp),
     .axi_narrow_out_req_o(narrow_out_req),
     .axi_narrow_out_rsp_i(narrow_out_rsp),
     .axi_wide_in_req_i   ('0),
@@ -472,4 +507,110 @@ module cheshire_tile
   assign fhg_spu_rst_no   = control_reg.fhg_spu_rsts.rst.value;
   assign fhg_spu_clk_en_o = control_reg.fhg_spu_clk_enables.clk_en.value;
 
+  ///////////////////////////////////
+  // Mem Tile Performance Counters //
+  ///////////////////////////////////
+
+  apb_req_t                                     perf_apb_req;
+  apb_resp_t                                    perf_apb_rsp;
+  pb_mem_perf_regs_pkg::pb_mem_perf_regs__in_t  perf_reg_in;
+  pb_mem_perf_regs_pkg::pb_mem_perf_regs__out_t perf_reg_out;
+
+  reg_to_apb #(
+    .reg_req_t(csh_reg_req_t),
+    .reg_rsp_t(csh_reg_rsp_t),
+    .apb_req_t(apb_req_t),
+    .apb_rsp_t(apb_resp_t)
+  ) i_perf_reg_to_apb (
+    .clk_i,
+    .rst_ni,
+    .reg_req_i(reg_ext_req[CshRegExtMemPerf]),
+    .reg_rsp_o(reg_ext_rsp[CshRegExtMemPerf]),
+    .apb_req_o(perf_apb_req),
+    .apb_rsp_i(perf_apb_rsp)
+  );
+
+  for (genvar i = 0; i < NumMemTiles; i++) begin : gen_mem_tile_perf_in
+    mem_tile_perf_t perf;
+    assign perf = perf_reg_out.ctrl.enable.value ? mem_tile_perf_i[i] : '0;
+    assign perf_reg_in.mem_tiles[i].cycles.count.incr          = perf.active;
+    assign perf_reg_in.mem_tiles[i].idle_cycles.count.incr     = perf.idle;
+    assign perf_reg_in.mem_tiles[i].narrow_rd_beats.count.incr = perf.narrow_rd_beat;
+    assign perf_reg_in.mem_tiles[i].narrow_wr_beats.count.incr = perf.narrow_wr_beat;
+    assign perf_reg_in.mem_tiles[i].wide_rd_beats.count.incr   = perf.wide_rd_beat;
+    assign perf_reg_in.mem_tiles[i].wide_wr_beats.count.incr   = perf.wide_wr_beat;
+    assign perf_reg_in.mem_tiles[i].conflict_cycles.count.incr = perf.conflict;
+    assign perf_reg_in.mem_tiles[i].stall_cycles.count.incr    = perf.stall;
+    assign perf_reg_in.mem_tiles[i].outstanding.count.incr     = perf.active;
+    assign perf_reg_in.mem_tiles[i].outstanding.count.incrvalue = perf.outstanding;
+  end
+
+  pb_mem_perf_regs i_pb_mem_perf_regs (
+    .clk          (clk_i),
+    .arst_n       (rst_ni),
+    .s_apb_paddr  (perf_apb_req.paddr[PB_MEM_PERF_REGS_MIN_ADDR_WIDTH-1:0]),
+    .s_apb_penable(perf_apb_req.penable),
+    .s_apb_psel   (perf_apb_req.psel),
+    .s_apb_pwrite (perf_apb_req.pwrite),
+    .s_apb_pprot  (perf_apb_req.pprot),
+    .s_apb_pwdata (perf_apb_req.pwdata),
+    .s_apb_pstrb  (perf_apb_req.pstrb),
+    .s_apb_prdata (perf_apb_rsp.prdata),
+    .s_apb_pready (perf_apb_rsp.pready),
+    .s_apb_pslverr(perf_apb_rsp.pslverr),
+    .hwif_in      (perf_reg_in),
+    .hwif_out     (perf_reg_out)
+  );
+
+  //////////////////////////////
+  // NoC Performance Counters //
+  //////////////////////////////
+
+  apb_req_t                                     noc_perf_apb_req;
+  apb_resp_t                                    noc_perf_apb_rsp;
+  pb_noc_perf_regs_pkg::pb_noc_perf_regs__in_t  noc_perf_reg_in;
+  pb_noc_perf_regs_pkg::pb_noc_perf_regs__out_t noc_perf_reg_out;
+
+  reg_to_apb #(
+    .reg_req_t(csh_reg_req_t),
+    .reg_rsp_t(csh_reg_rsp_t),
+    .apb_req_t(apb_req_t),
+    .apb_rsp_t(apb_resp_t)
+  ) i_noc_perf_reg_to_apb (
+    .clk_i,
+    .rst_ni,
+    .reg_req_i(reg_ext_req[CshRegExtNocPerf]),
+    .reg_rsp_o(reg_ext_rsp[CshRegExtNocPerf]),
+    .apb_req_o(noc_perf_apb_req),
+    .apb_rsp_i(noc_perf_apb_rsp)
+  );
+
+  assign noc_perf_ctrl_o = '{
+      enable: noc_perf_reg_out.ctrl.enable.value,
+      clear: noc_perf_reg_out.ctrl.clear.value,
+      x: noc_perf_reg_out.sel.x.value,
+      y: noc_perf_reg_out.sel.y.value,
+      port: route_direction_e'(noc_perf_reg_out.sel.port.value),
+      chan: noc_perf_chan_e'(noc_perf_reg_out.sel.channel.value),
+      cnt: noc_perf_cnt_e'(noc_perf_reg_out.sel.counter.value)
+  };
+  assign noc_perf_reg_in.data.value.next = noc_perf_data_i;
+
+  pb_noc_perf_regs i_pb_noc_perf_regs (
+    .clk          (clk_i),
+    .arst_n       (rst_ni),
+    .s_apb_paddr  (noc_perf_apb_req.paddr[PB_NOC_PERF_REGS_MIN_ADDR_WIDTH-1:0]),
+    .s_apb_penable(noc_perf_apb_req.penable),
+    .s_apb_psel   (noc_perf_apb_req.psel),
+    .s_apb_pwrite (noc_perf_apb_req.pwrite),
+    .s_apb_pprot  (noc_perf_apb_req.pprot),
+    .s_apb_pwdata (noc_perf_apb_req.pwdata),
+    .s_apb_pstrb  (noc_perf_apb_req.pstrb),
+    .s_apb_prdata (noc_perf_apb_rsp.prdata),
+    .s_apb_pready (noc_perf_apb_rsp.pready),
+    .s_apb_pslverr(noc_perf_apb_rsp.pslverr),
+    .hwif_in      (noc_perf_reg_in),
+    .hwif_out     (noc_perf_reg_out)
+  );
+
 endmodule
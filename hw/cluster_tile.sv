@@ -35,7 +35,10 @@ module cluster_tile
   output floo_wide_t                [ West:North] floo_wide_o,
   input  floo_req_t                 [ West:North] floo_req_i,
   output floo_rsp_t                 [ West:North] floo_rsp_o,
-  input  floo_wide_t                [ West:North] floo_wide_i
+  input  floo_wide_t                [ West:North] floo_wide_i,
+  // NoC performance counters
+  input  noc_perf_ctrl_t                          noc_perf_ctrl_i,
+  output noc_perf_data_t                          noc_perf_data_o
 );
 
   // Tile-specific reset and clock signals
@@ -55,6 +58,11 @@ module cluster_tile
   snitch_cluster_pkg::wide_in_req_t     cluster_wide_in_req;
   snitch_cluster_pkg::wide_in_resp_t    cluster_wide_in_rsp;
 
+  snitch_cluster_pkg::narrow_out_req_t  noc_narrow_in_req;
+  snitch_cluster_pkg::narrow_out_resp_t noc_narrow_in_rsp;
+  snitch_cluster_pkg::wide_out_req_t    noc_wide_in_req;
+  snitch_cluster_pkg::wide_out_resp_t   noc_wide_in_rsp;
+
   snitch_cluster_pkg::narrow_out_req_t  cluster_narrow_ext_req;
   snitch_cluster_pkg::narrow_out_resp_t cluster_narrow_ext_rsp;
   snitch_cluster_pkg::tcdm_dma_req_t    cluster_tcdm_ext_req_aligned;
@@ -254,6 +262,44 @@ module cluster_tile
   assign floo_wide_o                     = router_floo_wide_out[West:North];
   assign router_floo_wide_in[West:North] = floo_wide_i;
 
+  router_perf i_router_perf (
+    .clk_i,
+    .rst_ni,
+    .id_i,
+    .floo_req_in_i  (router_floo_req_in),
+    .floo_req_out_i (router_floo_req_out),
+    .floo_rsp_in_i  (router_floo_rsp_in),
+    .floo_rsp_out_i (router_floo_rsp_out),
+    .floo_wide_in_i (router_floo_wide_in),
+    .floo_wide_out_i(router_floo_wide_out),
+    .ctrl_i         (noc_perf_ctrl_i),
+    .data_o         (noc_perf_data_o)
+  );
+
+  /////////////////////
+  // L2 Interleaving //
+  /////////////////////
+
+  l2_interleave #(
+    .axi_req_t(snitch_cluster_pkg::narrow_out_req_t),
+    .axi_rsp_t(snitch_cluster_pkg::narrow_out_resp_t)
+  ) i_l2_interleave_narrow (
+    .slv_req_i(cluster_narrow_out_req),
+    .slv_rsp_o(cluster_narrow_out_rsp),
+    .mst_req_o(noc_narrow_in_req),
+    .mst_rsp_i(noc_narrow_in_rsp)
+  );
+
+  l2_interleave #(
+    .axi_req_t(snitch_cluster_pkg::wide_out_req_t),
+    .axi_rsp_t(snitch_cluster_pkg::wide_out_resp_t)
+  ) i_l2_interleave_wide (
+    .slv_req_i(cluster_wide_out_req),
+    .slv_rsp_o(cluster_wide_out_rsp),
+    .mst_req_o(noc_wide_in_req),
+    .mst_rsp_i(noc_wide_in_rsp)
+  );
+
   /////////////
   // Chimney //
   /////////////
@@ -293,12 +339,12 @@ module cluster_tile
     .id_i,
     .route_table_i       ('0),
     .sram_cfg_i          ('0),
-    .axi_narrow_in_req_i (cluster_narrow_out_req),
-    .axi_narrow_in_rsp_o (cluster_narrow_out_rsp),
+    .axi_narrow_in_req_i (noc_narrow_in_req),
+    .axi_narrow_in_rsp_o (noc_narrow_in_rsp),
     .axi_narrow_out_req_o(cluster_narrow_in_req),
     .axi_narrow_out_rsp_i(cluster_narrow_in_rsp),
-    .axi_wide_in_req_i   (cluster_wide_out_req),
-    .axi_wide_in_rsp_o   (cluster_wide_out_rsp),
+    .axi_wide_in_req_i   (noc_wide_in_req),
+    .axi_wide_in_rsp_o   (noc_wide_in_rsp),
     .axi_wide_out_req_o  (cluster_wide_in_req),
     .axi_wide_out_rsp_i  (cluster_wide_in_rsp),
     .floo_req_o          (router_floo_req_in[Eject]),
@@ -0,0 +1,39 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Remaps the addresses of the interleaved L2 window to the mem tiles, see
+// `picobello_pkg::l2_interleave_addr`. Placed in front of the manager ports
+// of the chimneys, such that the NoC only ever sees regular SAM addresses.
+module l2_interleave
+  import picobello_pkg::*;
+#(
+  parameter type axi_req_t = logic,
+  parameter type axi_rsp_t = logic
+) (
+  input  axi_req_t slv_req_i,
+  output axi_rsp_t slv_rsp_o,
+  output axi_req_t mst_req_o,
+  input  axi_rsp_t mst_rsp_i
+);
+
+  if (L2InterleaveEn) begin : gen_remap
+    axi_modify_address #(
+      .slv_req_t (axi_req_t),
+      .mst_addr_t(addr_t),
+      .mst_req_t (axi_req_t),
+      .axi_resp_t(axi_rsp_t)
+    ) i_axi_modify_address (
+      .slv_req_i,
+      .slv_resp_o   (slv_rsp_o),
+      .mst_aw_addr_i(l2_interleave_addr(slv_req_i.aw.addr)),
+      .mst_ar_addr_i(l2_interleave_addr(slv_req_i.ar.addr)),
+      .mst_req_o,
+      .mst_resp_i   (mst_rsp_i)
+    );
+  end else begin : gen_bypass
+    assign mst_req_o = slv_req_i;
+    assign slv_rsp_o = mst_rsp_i;
+  end
+
+endmodule
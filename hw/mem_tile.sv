@@ -33,7 +33,12 @@ module mem_tile
   output floo_wide_t [West:North] floo_wide_o,
   input  floo_req_t  [West:North] floo_req_i,
   output floo_rsp_t  [West:North] floo_rsp_o,
-  input  floo_wide_t [West:North] floo_wide_i
+  input  floo_wide_t [West:North] floo_wide_i,
+  // Performance events
+  output mem_tile_perf_t          perf_o,
+  // NoC performance counters
+  input  noc_perf_ctrl_t          noc_perf_ctrl_i,
+  output noc_perf_data_t          noc_perf_data_o
 );
 
   logic tile_clk;
@@ -81,6 +86,20 @@ module mem_tile
   assign floo_wide_o                     = router_floo_wide_out[West:North];
   assign router_floo_wide_in[West:North] = floo_wide_i;
 
+  router_perf i_router_perf (
+    .clk_i,
+    .rst_ni,
+    .id_i,
+    .floo_req_in_i  (router_floo_req_in),
+    .floo_req_out_i (router_floo_req_out),
+    .floo_rsp_in_i  (router_floo_rsp_in),
+    .floo_rsp_out_i (router_floo_rsp_out),
+    .floo_wide_in_i (router_floo_wide_in),
+    .floo_wide_out_i(router_floo_wide_out),
+    .ctrl_i         (noc_perf_ctrl_i),
+    .data_o         (noc_perf_data_o)
+  );
+
   /////////////
   // Chimney //
   /////////////
@@ -176,6 +195,44 @@ module mem_tile
     .axi_rsp_i       (axi_rsp)
   );
 
+  ////////////////////////
+  // Performance events //
+  ////////////////////////
+
+  mem_tile_perf_t perf_d;
+  logic [MemTilePerfOutstandingWidth-1:0] outstanding_q;
+  logic narrow_pending, wide_pending;
+
+  assign narrow_pending = axi_narrow_req.ar_valid | axi_narrow_req.aw_valid |
+                          axi_narrow_req.w_valid;
+  assign wide_pending = axi_wide_req.ar_valid | axi_wide_req.aw_valid | axi_wide_req.w_valid;
+
+  always_comb begin : proc_perf
+    perf_d.active         = 1'b1;
+    perf_d.narrow_rd_beat = axi_narrow_rsp.r_valid & axi_narrow_req.r_ready;
+    perf_d.narrow_wr_beat = axi_narrow_req.w_valid & axi_narrow_rsp.w_ready;
+    perf_d.wide_rd_beat   = axi_wide_rsp.r_valid & axi_wide_req.r_ready;
+    perf_d.wide_wr_beat   = axi_wide_req.w_valid & axi_wide_rsp.w_ready;
+    // The single-ported SRAM serves either the narrow or the wide port
+    perf_d.conflict       = narrow_pending & wide_pending;
+    perf_d.stall          = (axi_req.ar_valid & ~axi_rsp.ar_ready) |
+                            (axi_req.aw_valid & ~axi_rsp.aw_ready) |
+                            (axi_req.w_valid & ~axi_rsp.w_ready);
+    perf_d.idle           = ~narrow_pending & ~wide_pending & (outstanding_q == '0);
+    // Transactions are outstanding from their request until their last
+    // response beat
+    perf_d.outstanding    = outstanding_q +
+                            (axi_req.ar_valid & axi_rsp.ar_ready) +
+                            (axi_req.aw_valid & axi_rsp.aw_ready) -
+                            (axi_rsp.r_valid & axi_req.r_ready & axi_rsp.r.last) -
+                            (axi_rsp.b_valid & axi_req.b_ready);
+  end
+
+  `FF(outstanding_q, perf_d.outstanding, '0, tile_clk, tile_rst_n)
+  // Sampled with the ungated clock, such that no event is reported twice
+  // while the tile is clock gated
+  `FF(perf_o, (tile_clk_en_i || clk_rst_bypass_i) ? perf_d : '0, '0, clk_i, rst_ni)
+
   ///////////////////////
   // axi2obi converter //
   ///////////////////////
@@ -400,7 +400,9 @@ package picobello_pkg;
     CshRegExtFLL            = 1,  // FLL registers
     CshRegExtChipCtrl       = 2,  // Chip-level registers
     CshRegExtClkGatingRst   = 3,  // Tile-specific clock gating and reset control
-    CshRegExtNumSlv         = 4   // Number of external register slaves
+    CshRegExtMemPerf        = 4,  // Mem tile performance counters
+    CshRegExtNocPerf        = 5,  // NoC performance counters
+    CshRegExtNumSlv         = 6   // Number of external register slaves
   } cheshire_reg_ext_e;
 
   // Define function to derive configuration from Cheshire defaults.
@@ -427,6 +429,12 @@ package picobello_pkg;
     ret.RegExtRegionIdx[3]   = CshRegExtClkGatingRst;
     ret.RegExtRegionStart[3] = 'h1800_3000;
     ret.RegExtRegionEnd[3]   = 'h1800_4000;
+    ret.RegExtRegionIdx[4]   = CshRegExtMemPerf;
+    ret.RegExtRegionStart[4] = 'h1800_4000;
+    ret.RegExtRegionEnd[4]   = 'h1800_5000;
+    ret.RegExtRegionIdx[5]   = CshRegExtNocPerf;
+    ret.RegExtRegionStart[5] = 'h1800_5000;
+    ret.RegExtRegionEnd[5]   = 'h1800_6000;
     // TODO(fischeti): Currently, I don't see a reason to have a CIE region
     // Which is why we just set the CIE region to size 0 for now
     ret.Cva6ExtCieOnTop      = 0;
@@ -488,6 +496,110 @@ package picobello_pkg;
   localparam int unsigned SramAddrWidthOffset = SramBankSelOffset + SramBankSelWidth;
   localparam int unsigned SramMacroSelOffset = SramAddrWidthOffset + SramAddrWidth;
 
+  // The width of the outstanding transaction count of the performance events
+  localparam int unsigned MemTilePerfOutstandingWidth = 8;
+
+  // Performance events of a mem tile in a cycle, counted in the
+  // `pb_mem_perf_regs` register block of the Cheshire tile
+  typedef struct packed {
+    // The mem tile is clocked, all other events are only set if it is
+    logic active;
+    logic narrow_rd_beat;
+    logic narrow_wr_beat;
+    logic wide_rd_beat;
+    logic wide_wr_beat;
+    // Both the narrow and the wide port have a pending request
+    logic conflict;
+    // A request or write beat is pending but not accepted
+    logic stall;
+    // No request is pending and no transaction is outstanding
+    logic idle;
+    logic [MemTilePerfOutstandingWidth-1:0] outstanding;
+  } mem_tile_perf_t;
+
+  ///////////////////////
+  //  L2 Interleaving  //
+  ///////////////////////
+
+  // Optional window in which consecutive blocks rotate across all mem tiles,
+  // to spread large streams over the bandwidth of all tiles. The window lies
+  // outside of the FlooNoC SAM: its addresses are remapped to the top
+  // `L2InterleaveTileSize` bytes of every mem tile before entering the NoC.
+  // Configured in `cfg/l2_interleave.json`, shared with the software.
+  localparam bit L2InterleaveEn = pb_l2_interleave_pkg::L2InterleaveEn;
+  localparam addr_t L2InterleaveBase = addr_t'(pb_l2_interleave_pkg::L2InterleaveBase);
+  // The block size must be at least 4 KiB, since AXI bursts never cross
+  // 4 KiB boundaries and must not be split across tiles.
+  localparam int unsigned L2InterleaveBlockSize = pb_l2_interleave_pkg::L2InterleaveBlockSize;
+  // The part of every mem tile which is mapped to the window
+  localparam int unsigned L2InterleaveTileSize = pb_l2_interleave_pkg::L2InterleaveTileSize;
+  localparam int unsigned L2InterleaveTileOffset = MemTileSize - L2InterleaveTileSize;
+  localparam int unsigned L2InterleaveSize = NumMemTiles * L2InterleaveTileSize;
+
+  // Returns the mem tile address of an address in the interleaved window,
+  // and any other address unchanged.
+  function automatic addr_t l2_interleave_addr(addr_t addr);
+    addr_t offset, block;
+    if (!L2InterleaveEn || addr < L2InterleaveBase ||
+        addr >= L2InterleaveBase + L2InterleaveSize) begin
+      return addr;
+    end
+    offset = addr - L2InterleaveBase;
+    block  = offset / L2InterleaveBlockSize;
+    return Sam[L2Spm0SamIdx].start_addr + (block % NumMemTiles) * MemTileSize +
+           L2InterleaveTileOffset + (block / NumMemTiles) * L2InterleaveBlockSize +
+           offset % L2InterleaveBlockSize;
+  endfunction
+
+  ////////////////////////////////
+  //  NoC Performance Counters  //
+  ////////////////////////////////
+
+  // Count the flits and stalls on every port of every router. Only enabled by
+  // defining `PB_NOC_PERF_EN`, as in the simulation flow, to save area.
+`ifdef PB_NOC_PERF_EN
+  localparam bit NocPerfEn = 1'b1;
+`else
+  localparam bit NocPerfEn = 1'b0;
+`endif
+
+  typedef enum logic [1:0] {
+    NocPerfReq  = 0,
+    NocPerfRsp  = 1,
+    NocPerfWide = 2
+  } noc_perf_chan_e;
+
+  typedef enum logic [1:0] {
+    // Flits accepted by the router on a port
+    NocPerfInFlits   = 0,
+    // Flits forwarded by the router on a port
+    NocPerfOutFlits  = 1,
+    // Cycles in which a flit is forwarded on a port, but not accepted
+    NocPerfOutStalls = 2,
+    // Flits forwarded minus flits accepted on all ports, i.e. the number of
+    // multicast replicas once the router is drained. Independent of the port.
+    NocPerfReplicas  = 3
+  } noc_perf_cnt_e;
+
+  localparam int unsigned NocPerfNumChannels = 3;
+  localparam int unsigned NocPerfNumCounters = 3;
+
+  // Control of the NoC performance counters, from the `pb_noc_perf_regs`
+  // register block of the Cheshire tile
+  typedef struct packed {
+    logic             enable;
+    logic             clear;
+    // Router, in the coordinates of the FlooNoC configuration
+    logic [7:0]       x;
+    logic [7:0]       y;
+    route_direction_e port;
+    noc_perf_chan_e   chan;
+    noc_perf_cnt_e    cnt;
+  } noc_perf_ctrl_t;
+
+  // Selected counter, zero in all routers but the selected one
+  typedef logic [31:0] noc_perf_data_t;
+
   ////////////////////////
   //  SPM Narrow Tiles  //
   ////////////////////////
@@ -74,8 +74,24 @@ module picobello_top
 
   logic [NumClusters-1:0] cluster_clk_en, cluster_rst_n;
   logic [NumMemTiles-1:0] mem_tile_clk_en, mem_tile_rst_n;
+  mem_tile_perf_t [NumMemTiles-1:0] mem_tile_perf;
   logic fhg_spu_clk_en, fhg_spu_rst_n;
 
+  // NoC performance counters, the counter selected by Cheshire is returned by a
+  // single router, all others return zero.
+  noc_perf_ctrl_t noc_perf_ctrl;
+  noc_perf_data_t [MeshDim.x-1:0][MeshDim.y-1:0] noc_perf_data;
+  noc_perf_data_t noc_perf_data_sel;
+
+  always_comb begin : proc_noc_perf_data
+    noc_perf_data_sel = '0;
+    for (int x = 0; x < MeshDim.x; x++) begin
+      for (int y = 0; y < MeshDim.y; y++) begin
+        noc_perf_data_sel |= noc_perf_data[x][y];
+      end
+    end
+  end
+
   ///////////////////
   // Cluster tiles //
   ///////////////////
@@ -117,7 +133,9 @@ module picobello_top
       .floo_wide_o        (floo_wide_out[X][Y]),
       .floo_req_i         (floo_req_in[X][Y]),
       .floo_rsp_o         (floo_rsp_out[X][Y]),
-      .floo_wide_i        (floo_wide_in[X][Y])
+      .floo_wide_i        (floo_wide_in[X][Y]),
+      .noc_perf_ctrl_i    (noc_perf_ctrl),
+      .noc_perf_data_o    (noc_perf_data[X][Y])
     );
   end
 
@@ -187,6 +205,10 @@ module picobello_top
     .cluster_rst_no   (cluster_rst_n),
     .mem_tile_clk_en_o(mem_tile_clk_en),
     .mem_tile_rst_no  (mem_tile_rst_n),
+    .mem_tile_perf_i  (mem_tile_perf),
+    .noc_perf_ctrl_o  (noc_perf_ctrl),
+    .noc_perf_data_o  (noc_perf_data[CheshirePhysicalId.x][CheshirePhysicalId.y]),
+    .noc_perf_data_i  (noc_perf_data_sel),
     .fhg_spu_clk_en_o (fhg_spu_clk_en),
     .fhg_spu_rst_no   (fhg_spu_rst_n),
     .floo_req_west_o  (floo_req_out[CheshirePhysicalId.x][CheshirePhysicalId.y][West]),
@@ -260,6 +282,8 @@ module picobello_top
   assign floo_req_out[FhgSpuPhysicalId.x][FhgSpuPhysicalId.y][South]  = '0;
   assign floo_rsp_out[FhgSpuPhysicalId.x][FhgSpuPhysicalId.y][South]  = '0;
   assign floo_wide_out[FhgSpuPhysicalId.x][FhgSpuPhysicalId.y][South] = '0;
+  // The router of the FhG SPU tile is not monitored
+  assign noc_perf_data[FhgSpuPhysicalId.x][FhgSpuPhysicalId.y]        = '0;
 
   //////////////
   // Mem tile //
@@ -290,7 +314,10 @@ module picobello_top
       .floo_wide_o     (floo_wide_out[MemTileX][MemTileY]),
       .floo_req_i      (floo_req_in[MemTileX][MemTileY]),
       .floo_rsp_o      (floo_rsp_out[MemTileX][MemTileY]),
-      .floo_wide_i     (floo_wide_in[MemTileX][MemTileY])
+      .floo_wide_i     (floo_wide_in[MemTileX][MemTileY]),
+      .perf_o          (mem_tile_perf[m]),
+      .noc_perf_ctrl_i (noc_perf_ctrl),
+      .noc_perf_data_o (noc_perf_data[MemTileX][MemTileY])
     );
 
   end
@@ -325,14 +352,16 @@ module picobello_top
   ) i_narrow_spm_tile (
     .clk_i,
     .rst_ni,
-    .test_enable_i(test_mode_i),
-    .id_i         (SpmNarrowTileId),
-    .floo_req_o   (floo_req_out[SpmNarrowTileX][SpmNarrowTileY]),
-    .floo_rsp_i   (floo_rsp_in[SpmNarrowTileX][SpmNarrowTileY]),
-    .floo_wide_o  (floo_wide_out[SpmNarrowTileX][SpmNarrowTileY]),
-    .floo_req_i   (floo_req_in[SpmNarrowTileX][SpmNarrowTileY]),
-    .floo_rsp_o   (floo_rsp_out[SpmNarrowTileX][SpmNarrowTileY]),
-    .floo_wide_i  (floo_wide_in[SpmNarrowTileX][SpmNarrowTileY])
+    .test_enable_i  (test_mode_i),
+    .id_i           (SpmNarrowTileId),
+    .floo_req_o     (floo_req_out[SpmNarrowTileX][SpmNarrowTileY]),
+    .floo_rsp_i     (floo_rsp_in[SpmNarrowTileX][SpmNarrowTileY]),
+    .floo_wide_o    (floo_wide_out[SpmNarrowTileX][SpmNarrowTileY]),
+    .floo_req_i     (floo_req_in[SpmNarrowTileX][SpmNarrowTileY]),
+    .floo_rsp_o     (floo_rsp_out[SpmNarrowTileX][SpmNarrowTileY]),
+    .floo_wide_i    (floo_wide_in[SpmNarrowTileX][SpmNarrowTileY]),
+    .noc_perf_ctrl_i(noc_perf_ctrl),
+    .noc_perf_data_o(noc_perf_data[SpmNarrowTileX][SpmNarrowTileY])
   );
 
   // Wide SPM tile
@@ -361,14 +390,16 @@ module picobello_top
   ) i_wide_spm_tile (
     .clk_i,
     .rst_ni,
-    .test_enable_i(test_mode_i),
-    .id_i         (SpmWideTileId),
-    .floo_req_o   (floo_req_out[SpmWideTileX][SpmWideTileY]),
-    .floo_rsp_i   (floo_rsp_in[SpmWideTileX][SpmWideTileY]),
-    .floo_wide_o  (floo_wide_out[SpmWideTileX][SpmWideTileY]),
-    .floo_req_i   (floo_req_in[SpmWideTileX][SpmWideTileY]),
-    .floo_rsp_o   (floo_rsp_out[SpmWideTileX][SpmWideTileY]),
-    .floo_wide_i  (floo_wide_in[SpmWideTileX][SpmWideTileY])
+    .test_enable_i  (test_mode_i),
+    .id_i           (SpmWideTileId),
+    .floo_req_o     (floo_req_out[SpmWideTileX][SpmWideTileY]),
+    .floo_rsp_i     (floo_rsp_in[SpmWideTileX][SpmWideTileY]),
+    .floo_wide_o    (floo_wide_out[SpmWideTileX][SpmWideTileY]),
+    .floo_req_i     (floo_req_in[SpmWideTileX][SpmWideTileY]),
+    .floo_rsp_o     (floo_rsp_out[SpmWideTileX][SpmWideTileY]),
+    .floo_wide_i    (floo_wide_in[SpmWideTileX][SpmWideTileY]),
+    .noc_perf_ctrl_i(noc_perf_ctrl),
+    .noc_perf_data_o(noc_perf_data[SpmWideTileX][SpmWideTileY])
   );
 
   ////////////////
@@ -384,14 +415,16 @@ module picobello_top
     dummy_tile i_dummy_tile (
       .clk_i,
       .rst_ni,
-      .test_enable_i(test_mode_i),
-      .id_i         (DummyTileId),
-      .floo_req_o   (floo_req_out[DummyTileX][DummyTileY]),
-      .floo_rsp_i   (floo_rsp_in[DummyTileX][DummyTileY]),
-      .floo_wide_o  (floo_wide_out[DummyTileX][DummyTileY]),
-      .floo_req_i   (floo_req_in[DummyTileX][DummyTileY]),
-      .floo_rsp_o   (floo_rsp_out[DummyTileX][DummyTileY]),
-      .floo_wide_i  (floo_wide_in[DummyTileX][DummyTileY])
+      .test_enable_i  (test_mode_i),
+      .id_i           (DummyTileId),
+      .floo_req_o     (floo_req_out[DummyTileX][DummyTileY]),
+      .floo_rsp_i     (floo_rsp_in[DummyTileX][DummyTileY]),
+      .floo_wide_o    (floo_wide_out[DummyTileX][DummyTileY]),
+      .floo_req_i     (floo_req_in[DummyTileX][DummyTileY]),
+      .floo_rsp_o     (floo_rsp_out[DummyTileX][DummyTileY]),
+      .floo_wide_i    (floo_wide_in[DummyTileX][DummyTileY]),
+      .noc_perf_ctrl_i(noc_perf_ctrl),
+      .noc_perf_data_o(noc_perf_data[DummyTileX][DummyTileY])
     );
   end
 
@@ -0,0 +1,114 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+`include "common_cells/registers.svh"
+
+// Performance counters of a router, on all its ports and channels. The
+// counters are controlled and read through the `pb_noc_perf_regs` register
+// block of the Cheshire tile, and dumped to `noc_perf_x<x>_y<y>.csv` at the
+// end of a simulation.
+module router_perf
+  import floo_pkg::*;
+  import floo_picobello_noc_pkg::*;
+  import picobello_pkg::*;
+(
+  input  logic                       clk_i,
+  input  logic                       rst_ni,
+  input  id_t                        id_i,
+  // Inputs and outputs of the router
+  input  floo_req_t  [Eject:North]   floo_req_in_i,
+  input  floo_req_t  [Eject:North]   floo_req_out_i,
+  input  floo_rsp_t  [Eject:North]   floo_rsp_in_i,
+  input  floo_rsp_t  [Eject:North]   floo_rsp_out_i,
+  input  floo_wide_t [Eject:North]   floo_wide_in_i,
+  input  floo_wide_t [Eject:North]   floo_wide_out_i,
+  // Counter control and selected counter
+  input  noc_perf_ctrl_t             ctrl_i,
+  output noc_perf_data_t             data_o
+);
+
+  localparam int unsigned NumPorts = int'(Eject) + 1;
+
+  if (NocPerfEn) begin : gen_perf
+
+    typedef noc_perf_data_t [NocPerfNumChannels-1:0][NocPerfNumCounters-1:0] port_cnt_t;
+
+    logic [NumPorts-1:0][NocPerfNumChannels-1:0] in_valid, in_ready, out_valid, out_ready;
+    logic [NumPorts-1:0][NocPerfNumChannels-1:0][NocPerfNumCounters-1:0] events;
+    port_cnt_t [NumPorts-1:0] cnt_q;
+    noc_perf_data_t [NocPerfNumChannels-1:0] replicas;
+    noc_perf_data_t data_d;
+
+    // The `ready` of a link acknowledges the flits of the opposite link
+    for (genvar p = 0; p < NumPorts; p++) begin : gen_port
+      assign in_valid[p][NocPerfReq]   = floo_req_in_i[p].valid;
+      assign in_ready[p][NocPerfReq]   = floo_req_out_i[p].ready;
+      assign out_valid[p][NocPerfReq]  = floo_req_out_i[p].valid;
+      assign out_ready[p][NocPerfReq]  = floo_req_in_i[p].ready;
+      assign in_valid[p][NocPerfRsp]   = floo_rsp_in_i[p].valid;
+      assign in_ready[p][NocPerfRsp]   = floo_rsp_out_i[p].ready;
+      assign out_valid[p][NocPerfRsp]  = floo_rsp_out_i[p].valid;
+      assign out_ready[p][NocPerfRsp]  = floo_rsp_in_i[p].ready;
+      assign in_valid[p][NocPerfWide]  = floo_wide_in_i[p].valid;
+      assign in_ready[p][NocPerfWide]  = floo_wide_out_i[p].ready;
+      assign out_valid[p][NocPerfWide] = floo_wide_out_i[p].valid;
+      assign out_ready[p][NocPerfWide] = floo_wide_in_i[p].ready;
+
+      for (genvar c = 0; c < NocPerfNumChannels; c++) begin : gen_chan
+        assign events[p][c][NocPerfInFlits]   = in_valid[p][c] & in_ready[p][c];
+        assign events[p][c][NocPerfOutFlits]  = out_valid[p][c] & out_ready[p][c];
+        assign events[p][c][NocPerfOutStalls] = out_valid[p][c] & ~out_ready[p][c];
+
+        for (genvar k = 0; k < NocPerfNumCounters; k++) begin : gen_cnt
+          `FFLARNC(cnt_q[p][c][k], cnt_q[p][c][k] + 1, ctrl_i.enable & events[p][c][k],
+                   ctrl_i.clear, '0, clk_i, rst_ni)
+        end
+      end
+    end
+
+    always_comb begin : proc_replicas
+      for (int c = 0; c < NocPerfNumChannels; c++) begin
+        replicas[c] = '0;
+        for (int p = 0; p < NumPorts; p++) begin
+          replicas[c] += cnt_q[p][c][NocPerfOutFlits] - cnt_q[p][c][NocPerfInFlits];
+        end
+      end
+    end
+
+    always_comb begin : proc_data
+      data_d = '0;
+      if (ctrl_i.x == id_i.x && ctrl_i.y == id_i.y && ctrl_i.chan < NocPerfNumChannels) begin
+        if (ctrl_i.cnt == NocPerfReplicas) begin
+          data_d = replicas[ctrl_i.chan];
+        end else if (ctrl_i.port < NumPorts) begin
+          data_d = cnt_q[ctrl_i.port][ctrl_i.chan][ctrl_i.cnt];
+        end
+      end
+    end
+
+    `FF(data_o, data_d, '0, clk_i, rst_ni)
+
+`ifndef SYNTHESIS
+    final begin : proc_dump
+      string chan_name[NocPerfNumChannels] = '{"req", "rsp", "wide"};
+      int fd;
+      fd = $fopen($sformatf("noc_perf_x%0d_y%0d.csv", id_i.x, id_i.y), "w");
+      // The replicas are counted over all ports, and repeated on every port
+      $fwrite(fd, "port,channel,in_flits,out_flits,out_stalls,replicas\n");
+      for (int p = 0; p < NumPorts; p++) begin
+        for (int c = 0; c < NocPerfNumChannels; c++) begin
+          $fwrite(fd, "%s,%s,%0d,%0d,%0d,%0d\n", route_direction_e'(p).name(), chan_name[c],
+                  cnt_q[p][c][NocPerfInFlits], cnt_q[p][c][NocPerfOutFlits],
+                  cnt_q[p][c][NocPerfOutStalls], replicas[c]);
+        end
+      end
+      $fclose(fd);
+    end
+`endif
+
+  end else begin : gen_no_perf
+    assign data_o = '0;
+  end
+
+endmodule
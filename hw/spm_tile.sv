@@ -72,7 +72,10 @@ module spm_tile
   output floo_wide_t [West:North] floo_wide_o,
   input  floo_req_t  [West:North] floo_req_i,
   output floo_rsp_t  [West:North] floo_rsp_o,
-  input  floo_wide_t [West:North] floo_wide_i
+  input  floo_wide_t [West:North] floo_wide_i,
+  // NoC performance counters
+  input  noc_perf_ctrl_t          noc_perf_ctrl_i,
+  output noc_perf_data_t          noc_perf_data_o
 );
 
   ////////////
@@ -116,6 +119,20 @@ module spm_tile
   assign floo_wide_o                     = router_floo_wide_out[West:North];
   assign router_floo_wide_in[West:North] = floo_wide_i;
 
+  router_perf i_router_perf (
+    .clk_i,
+    .rst_ni,
+    .id_i,
+    .floo_req_in_i  (router_floo_req_in),
+    .floo_req_out_i (router_floo_req_out),
+    .floo_rsp_in_i  (router_floo_rsp_in),
+    .floo_rsp_out_i (router_floo_rsp_out),
+    .floo_wide_in_i (router_floo_wide_in),
+    .floo_wide_out_i(router_floo_wide_out),
+    .ctrl_i         (noc_perf_ctrl_i),
+    .data_o         (noc_perf_data_o)
+  );
+
   /////////////
   // Chimney //
   /////////////
@@ -0,0 +1,68 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the mem tile performance counters. It accesses a single
+// memory tile with narrow reads and writes, and checks that only the
+// counters of this tile are incremented.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+
+#define NUM_L2_MEM_TILES 8
+#define TEST_TILE 2
+#define NUM_ACCESSES 16
+
+int main() {
+
+    uint32_t n_errors = 0;
+
+    volatile pb_mem_perf_regs_t *perf = &picobello_addrmap.cheshire_internal.pb_mem_perf_regs;
+    volatile uint32_t *l2 = (volatile uint32_t *)&picobello_addrmap.l2_spm[TEST_TILE];
+
+    // Clear the counters of all tiles
+    for (uint32_t i = 0; i < NUM_L2_MEM_TILES; i++) {
+        perf->mem_tiles[i].cycles.f.count = 0;
+        perf->mem_tiles[i].idle_cycles.f.count = 0;
+        perf->mem_tiles[i].narrow_rd_beats.f.count = 0;
+        perf->mem_tiles[i].narrow_wr_beats.f.count = 0;
+        perf->mem_tiles[i].wide_rd_beats.f.count = 0;
+        perf->mem_tiles[i].wide_wr_beats.f.count = 0;
+        perf->mem_tiles[i].conflict_cycles.f.count = 0;
+        perf->mem_tiles[i].stall_cycles.f.count = 0;
+        perf->mem_tiles[i].outstanding.f.count = 0;
+    }
+
+    // Access the test tile while counting
+    perf->ctrl.f.enable = 1;
+    for (uint32_t i = 0; i < NUM_ACCESSES; i++) l2[i] = i;
+    for (uint32_t i = 0; i < NUM_ACCESSES; i++) n_errors += (l2[i] != i);
+    perf->ctrl.f.enable = 0;
+
+    // Accesses may be merged or hit in the data cache, so the test tile sees
+    // at least one access of each kind
+    for (uint32_t i = 0; i < NUM_L2_MEM_TILES; i++) {
+        uint32_t accessed = (i == TEST_TILE);
+        n_errors += ((perf->mem_tiles[i].narrow_wr_beats.f.count != 0) != accessed);
+        n_errors += ((perf->mem_tiles[i].narrow_rd_beats.f.count != 0) != accessed);
+        n_errors += (perf->mem_tiles[i].wide_wr_beats.f.count != 0);
+        n_errors += (perf->mem_tiles[i].wide_rd_beats.f.count != 0);
+        n_errors += (perf->mem_tiles[i].conflict_cycles.f.count != 0);
+    }
+
+    // Every transaction is outstanding for at least a cycle, and the tile is
+    // idle for the rest of the time
+    volatile pb_mem_perf_regs__mem_tile_perf_t *tile = &perf->mem_tiles[TEST_TILE];
+    n_errors += (tile->outstanding.f.count < tile->narrow_wr_beats.f.count);
+    n_errors += (tile->idle_cycles.f.count == 0);
+    n_errors += (tile->idle_cycles.f.count >= tile->cycles.f.count);
+
+    // Counters are frozen while disabled
+    uint32_t cycles = tile->cycles.f.count;
+    uint32_t wr_beats = tile->narrow_wr_beats.f.count;
+    l2[0] = 0;
+    n_errors += (tile->cycles.f.count != cycles);
+    n_errors += (tile->narrow_wr_beats.f.count != wr_beats);
+
+    return n_errors;
+}
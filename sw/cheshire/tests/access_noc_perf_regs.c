@@ -0,0 +1,78 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the router performance counters. Cheshire accesses the
+// first memory tile with narrow reads and writes, and checks that the
+// requests are counted at the local ports of both routers.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+
+#define NUM_ACCESSES 16
+
+// Logical router coordinates
+#define CHESHIRE_X 9
+#define CHESHIRE_Y 3
+#define MEM_TILE_0_X 0
+#define MEM_TILE_0_Y 0
+
+// Selector values, see `picobello_pkg`
+#define PORT_EJECT 4
+#define CHAN_REQ 0
+#define CNT_IN_FLITS 0
+#define CNT_OUT_FLITS 1
+#define CNT_REPLICAS 3
+
+static uint32_t read_counter(volatile pb_noc_perf_regs_t *perf, uint32_t x, uint32_t y,
+                             uint32_t port, uint32_t chan, uint32_t cnt) {
+    perf->sel.f.x = x;
+    perf->sel.f.y = y;
+    perf->sel.f.port = port;
+    perf->sel.f.channel = chan;
+    perf->sel.f.counter = cnt;
+    // The selected counter is registered in the router
+    (void)perf->sel.w;
+    return perf->data.f.value;
+}
+
+int main() {
+
+    uint32_t n_errors = 0;
+
+    volatile pb_noc_perf_regs_t *perf = &picobello_addrmap.cheshire_internal.pb_noc_perf_regs;
+    volatile uint32_t *l2 = (volatile uint32_t *)&picobello_addrmap.l2_spm[0];
+
+    // Access the first mem tile while counting
+    perf->ctrl.f.clear = 1;
+    perf->ctrl.f.enable = 1;
+    for (uint32_t i = 0; i < NUM_ACCESSES; i++) l2[i] = i;
+    for (uint32_t i = 0; i < NUM_ACCESSES; i++) n_errors += (l2[i] != i);
+    asm volatile("fence" ::: "memory");
+    perf->ctrl.f.enable = 0;
+
+    // Requests enter the NoC at Cheshire and leave it at the mem tile
+    uint32_t chs_in = read_counter(perf, CHESHIRE_X, CHESHIRE_Y, PORT_EJECT, CHAN_REQ,
+                                   CNT_IN_FLITS);
+    uint32_t mem_out = read_counter(perf, MEM_TILE_0_X, MEM_TILE_0_Y, PORT_EJECT, CHAN_REQ,
+                                    CNT_OUT_FLITS);
+    n_errors += (chs_in == 0);
+    n_errors += (mem_out == 0);
+    n_errors += (chs_in != mem_out);
+
+    // Unicast requests are never replicated
+    n_errors += (read_counter(perf, CHESHIRE_X, CHESHIRE_Y, 0, CHAN_REQ, CNT_REPLICAS) != 0);
+
+    // Counters are frozen while disabled
+    l2[0] = 0;
+    asm volatile("fence" ::: "memory");
+    n_errors += (read_counter(perf, CHESHIRE_X, CHESHIRE_Y, PORT_EJECT, CHAN_REQ,
+                              CNT_IN_FLITS) != chs_in);
+
+    // Counters are cleared
+    perf->ctrl.f.clear = 1;
+    n_errors += (read_counter(perf, CHESHIRE_X, CHESHIRE_Y, PORT_EJECT, CHAN_REQ,
+                              CNT_IN_FLITS) != 0);
+
+    return n_errors;
+}
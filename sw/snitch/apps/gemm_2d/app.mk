@@ -8,10 +8,14 @@ APP              := gemm_2d
 $(APP)_BUILD_DIR ?= $(PB_SNITCH_SW_DIR)/apps/$(APP)/build
 SRC_DIR          := $(PB_SNITCH_SW_DIR)/apps/$(APP)/src
 SRCS             := $(SRC_DIR)/gemm_2d.c
+$(APP)_DATA_CFG  := $(PB_SNITCH_SW_DIR)/apps/$(APP)/data/params.json
 $(APP)_INCDIRS   := $(SN_ROOT)/sw/kernels/blas $(SN_ROOT)/sw/kernels/blas/gemm/src
 
-# Refer to Snitch scripts
-$(APP)_SCRIPT_DIR :=  $(SN_ROOT)/sw/kernels/blas/gemm/scripts
+# Picobello scripts extend the Snitch GEMM scripts
+$(APP)_SCRIPT_DIR := $(PB_SNITCH_SW_DIR)/apps/$(APP)/scripts
+
+# The data generator derives the cluster mesh from the FlooNoC configuration
+export FLOO_CFG
 
 include $(SN_ROOT)/sw/kernels/datagen.mk
 include $(SN_ROOT)/sw/kernels/common.mk
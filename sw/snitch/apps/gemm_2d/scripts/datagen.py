@@ -0,0 +1,325 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Data generation for the picobello `gemm_2d` app.
+#
+# The `gemm_args_t` job arguments are emitted as by the Snitch GEMM data
+# generator, whose validation and golden model are reused. The
+# picobello-specific knobs, which have no counterpart in `gemm_args_t`, are
+# stripped from the parameters and emitted in a separate `pb_gemm_args_t`
+# struct (see `src/gemm_2d.h`).
+#
+# Instead of the full A and C arrays, the rows of A and C used by every
+# cluster are emitted in the linker section of the memory tile closest to
+# the cluster (`pb_slabs`), and the blocks of C stored by the kernel are
+# listed in `pb_c_blocks` for the verification script. The
+# cluster mesh and the memory tile closest to every cluster are derived from
+# the FlooNoC configuration (`FLOO_CFG`), as in `pb_noc_cfg.h`.
+#
+# If `tuned` is set, the configuration tuned by `tune.py` for the problem
+# shape overrides the tiling, buffering and parallelization parameters, so
+# that the kernel runs, and the data is laid out, with that configuration.
+# `tuned` is only a data generation parameter and is not emitted.
+
+import importlib.util
+import json
+import os
+import re
+import sys
+from pathlib import Path
+
+import numpy as np
+import snitch.util.sim.data_utils as du
+
+PB_ROOT = Path(__file__).resolve().parents[5]
+SN_GEMM_SCRIPT_DIR = PB_ROOT / '.deps/snitch_cluster/sw/kernels/blas/gemm/scripts'
+GEN_NOC_CFG_PY = PB_ROOT / 'sw/snitch/runtime/scripts/gen_noc_cfg.py'
+FLOO_CFG = Path(os.environ.get('FLOO_CFG', PB_ROOT / 'cfg/picobello_noc.yml'))
+TUNED_CONFIGS = Path(__file__).resolve().parent.parent / 'data/tuned.json'
+
+# Maximum number of buffers per operand, see `MAX_NUM_BUFFERS` in `src/gemm_2d.c`
+MAX_NUM_BUFFERS = 4
+
+# Picobello-specific parameters and their default values
+PB_GEMM_ARGS = {
+    'parallelize_n': 0,
+    'mcast': 0,
+    'num_buffers': 0,
+    'loop_order': 0,
+    'use_redmule': 0,
+}
+
+# Parameters of the configurations tuned by `tune.py`
+PB_GEMM_CONFIG_SHAPE = ['m', 'n', 'k', 'prec']
+PB_GEMM_CONFIG_KNOBS = ['m_tiles', 'n_tiles', 'k_tiles', 'parallelize_m', 'parallelize_k',
+                        'double_buffer', 'partition_banks', 'parallelize_n', 'mcast',
+                        'num_buffers', 'loop_order']
+
+
+def load_module(name, path):
+    """Load a module from a file under a unique name."""
+    spec = importlib.util.spec_from_file_location(name, path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+def load_sn_gemm_module(name):
+    """Load a module from the Snitch GEMM scripts under a unique name."""
+    return load_module(f'sn_gemm_{name}', SN_GEMM_SCRIPT_DIR / f'{name}.py')
+
+
+GemmDataGen = load_sn_gemm_module('datagen').GemmDataGen
+
+# Cluster mesh, see `pb_noc_cfg.h` and `pb_team.h`
+NOC = load_module('pb_gen_noc_cfg', GEN_NOC_CFG_PY).PbNoc(FLOO_CFG)
+NUM_CLUSTERS = len(NOC.clusters)
+PB_CLUSTER_PER_ROW = NOC.cluster_per_row
+PB_CLUSTER_PER_COL = NOC.cluster_per_col
+
+# Root of the K-parallel reduction, see `REDUCTION_ROOT_IDX` in `src/gemm_2d.c`
+REDUCTION_ROOT_IDX = ((PB_CLUSTER_PER_ROW - 1) // 2) * PB_CLUSTER_PER_COL + \
+    (PB_CLUSTER_PER_COL - 1) // 2
+
+
+def gemm_prec(gemm_fp):
+    """Precision in bits of a `gemm_fp` kernel name."""
+    return int(re.match(r'gemm_fp(\d+)_', gemm_fp).group(1))
+
+
+def load_tuned_configs(path=TUNED_CONFIGS):
+    """Load the configurations tuned by `tune.py`, if any."""
+    if not path.exists():
+        return []
+    with open(path) as f:
+        return json.load(f)
+
+
+def find_tuned_config(configs, m, n, k, prec):
+    """Find the tuned configuration of a shape, `prec` being in bytes."""
+    shape = [m, n, k, prec]
+    return next((cfg for cfg in configs
+                 if [cfg[key] for key in PB_GEMM_CONFIG_SHAPE] == shape), None)
+
+
+def pb_cluster_row(c):
+    return c % PB_CLUSTER_PER_COL
+
+
+def pb_cluster_col(c):
+    return c // PB_CLUSTER_PER_COL
+
+
+def pb_closest_mem_tile(c):
+    return NOC.closest_mem_tile(c)
+
+
+def distribute_tiles(num_tiles, num_parts, part_idx):
+    """Mirror of `distribute_tiles` in `src/gemm_2d.c`."""
+    quotient, remainder = divmod(num_tiles, num_parts)
+    count = quotient + (part_idx < remainder)
+    first = part_idx * quotient + min(part_idx, remainder)
+    return count, first
+
+
+def tile_size(size, num_tiles):
+    """Size of a full tile, see `gemm_picobello()` in `src/gemm_2d.c`."""
+    return -(-size // num_tiles)
+
+
+def cluster_tiles(c, parallelize_m, parallelize_n, mcast, m_tiles, n_tiles):
+    """Return the blocks of C tiles assigned to cluster `c` by the kernel.
+
+    Every block is a tuple (m_first, m_count, n_first, n_count) in units of tiles.
+    """
+    m_parts, m_part_idx = 1, 0
+    n_parts, n_part_idx = 1, 0
+    if parallelize_m and parallelize_n:
+        m_parts, m_part_idx = PB_CLUSTER_PER_COL, pb_cluster_row(c)
+        n_parts, n_part_idx = PB_CLUSTER_PER_ROW, pb_cluster_col(c)
+    elif parallelize_m:
+        m_parts, m_part_idx = NUM_CLUSTERS, c
+    elif parallelize_n:
+        n_parts, n_part_idx = NUM_CLUSTERS, c
+
+    # Contiguous range of (m, n) tiles, see `flat` in `src/gemm_2d.c`
+    flat = (bool(parallelize_m) != bool(parallelize_n)) and not mcast and \
+        (m_tiles % m_parts or n_tiles % n_parts)
+    if flat:
+        count, first = distribute_tiles(m_tiles * n_tiles, NUM_CLUSTERS, c)
+        blocks = []
+        for item in range(first, first + count):
+            m_tile, n_tile = divmod(item, n_tiles)
+            if blocks and blocks[-1][0] == m_tile:
+                blocks[-1][3] += 1
+            else:
+                blocks.append([m_tile, 1, n_tile, 1])
+        return [tuple(block) for block in blocks]
+
+    m_count, m_first = distribute_tiles(m_tiles, m_parts, m_part_idx)
+    n_count, n_first = distribute_tiles(n_tiles, n_parts, n_part_idx)
+    if m_count == 0 or n_count == 0:
+        return []
+    return [(m_first, m_count, n_first, n_count)]
+
+
+class PbGemmDataGen(GemmDataGen):
+
+    def pop_pb_args(self, kwargs):
+        return {key: kwargs.pop(key, default) for key, default in PB_GEMM_ARGS.items()}
+
+    def apply_tuned_config(self, pb_args, kwargs):
+        cfg = find_tuned_config(load_tuned_configs(), kwargs['m'], kwargs['n'], kwargs['k'],
+                                gemm_prec(kwargs['gemm_fp']) // 8)
+        if cfg is None:
+            raise ValueError('No tuned configuration for this shape, run tune.py first')
+        for key in PB_GEMM_CONFIG_KNOBS:
+            if key in pb_args:
+                pb_args[key] = cfg[key]
+            else:
+                kwargs[key] = cfg[key]
+
+    def validate_pb_config(self, pb_args, **kwargs):
+        if pb_args['parallelize_n'] and kwargs['parallelize_k']:
+            raise ValueError('Cannot parallelize N and K simultaneously')
+        prec = gemm_prec(kwargs['gemm_fp'])
+        if kwargs['parallelize_k'] and prec not in [32, 64]:
+            raise ValueError('K-parallel GEMM only supports FP64 and FP32 reductions')
+        if kwargs['parallelize_k'] and kwargs['partition_banks']:
+            raise ValueError('K-parallel GEMM does not support partitioned banks')
+        if pb_args['use_redmule']:
+            if prec not in [8, 16]:
+                raise ValueError('RedMulE only supports FP16 and FP8 GEMMs')
+            if kwargs['transa'] or kwargs['transb'] or kwargs['partition_banks']:
+                raise ValueError('RedMulE requires non-transposed, contiguous tiles')
+            if kwargs['alpha'] != 1 or kwargs['beta'] not in [0, 1]:
+                raise ValueError('RedMulE does not scale its operands,'
+                                 ' alpha must be 1 and beta 0 or 1')
+        if pb_args['mcast'] and kwargs['partition_banks']:
+            raise ValueError('Multicast is not supported with partitioned banks')
+        if pb_args['num_buffers'] > MAX_NUM_BUFFERS:
+            raise ValueError(f'At most {MAX_NUM_BUFFERS} buffers per operand are supported')
+        if pb_args['loop_order'] not in [0, 1, 2]:
+            raise ValueError('Loop order must be 0 (auto), 1 (k-n-m) or 2 (n-k-m)')
+        if pb_args['loop_order'] == 2:
+            # Every working cluster needs as many N tiles as buffers, see
+            # `nkm_supported` in `src/gemm_2d.c`
+            n_parts = 1
+            if pb_args['parallelize_n']:
+                n_parts = PB_CLUSTER_PER_ROW if kwargs['parallelize_m'] else NUM_CLUSTERS
+            min_n_tiles = kwargs['n_tiles'] // n_parts or 1
+            num_buffers = pb_args['num_buffers'] or (2 if kwargs['double_buffer'] else 1)
+            if min_n_tiles < num_buffers:
+                raise ValueError(f'n-k-m loop order requires at least {num_buffers} N tiles'
+                                 ' per cluster')
+        if pb_args['num_buffers'] > 1 and not kwargs['double_buffer']:
+            raise ValueError('Multiple buffers require double_buffer')
+        if pb_args['num_buffers'] > 2 and kwargs['partition_banks']:
+            raise ValueError('More than two buffers are not supported with partitioned banks')
+        if kwargs['transa']:
+            raise ValueError('Placing A in the memory tiles requires a non-transposed A')
+        if kwargs['parallelize_k'] and kwargs['k_tiles'] % NUM_CLUSTERS:
+            raise ValueError(f'K-parallel GEMM requires a multiple of {NUM_CLUSTERS} K tiles')
+
+    def validate_config(self, **kwargs):
+        # Dimensions need not be a multiple of the number of tiles: the last
+        # tile along a dimension can be smaller (ragged), but not empty
+        full, edge, ragged = {}, {}, False
+        for dim in ['m', 'n', 'k']:
+            size, num_tiles = kwargs[dim], kwargs[f'{dim}_tiles']
+            tile = tile_size(size, num_tiles)
+            if (num_tiles - 1) * tile >= size:
+                raise ValueError(f'{dim.upper()} = {size} can\'t be split in'
+                                 f' {num_tiles} non-empty tiles')
+            full[dim] = num_tiles * tile
+            edge[dim] = size - (num_tiles - 1) * tile
+            edge[f'{dim}_tiles'] = 1
+            ragged |= edge[dim] != tile
+        if ragged and kwargs['partition_banks']:
+            raise ValueError('Ragged tiles are not supported with partitioned banks')
+
+        # Both the full and the ragged edge tiles must be supported by the
+        # selected kernel
+        super().validate_config(**{**kwargs, **full})
+        if ragged:
+            super().validate_config(**{**kwargs, **edge, 'parallelize_m': 0,
+                                       'parallelize_k': 0})
+
+    def emit_slabs(self, ctype, a, c, pb_args, **kwargs):
+        """Emit the rows of A and C used by every cluster in its closest memory tile."""
+        m, n = kwargs['m'], kwargs['n']
+        tile_m = tile_size(m, kwargs['m_tiles'])
+        tile_n = tile_size(n, kwargs['n_tiles'])
+
+        header = []
+        slabs = {}
+        table = []
+        c_blocks = []
+        for cluster in range(NUM_CLUSTERS):
+            blocks = cluster_tiles(cluster, kwargs['parallelize_m'], pb_args['parallelize_n'],
+                                   pb_args['mcast'], kwargs['m_tiles'], kwargs['n_tiles'])
+            if not blocks:
+                table.append('{NULL, NULL, 0}')
+                continue
+            row = blocks[0][0] * tile_m
+            rows = min(m, (blocks[-1][0] + blocks[-1][1]) * tile_m) - row
+            tile = pb_closest_mem_tile(cluster)
+            key = (tile, row, rows)
+            if key not in slabs:
+                slab = len(slabs)
+                slabs[key] = slab
+                section = f'.l2_tile_{tile}' if tile else None
+                header += [du.format_array_definition(ctype, f'a_slab_{slab}',
+                                                      a[row:row + rows].flatten(), section=section)]
+                header += [du.format_array_definition(ctype, f'c_slab_{slab}',
+                                                      c[row:row + rows].flatten(), section=section)]
+            slab = slabs[key]
+            table.append(f'{{a_slab_{slab}, c_slab_{slab}, {row}}}')
+            if not kwargs['parallelize_k'] or cluster == REDUCTION_ROOT_IDX:
+                for m_first, m_count, n_first, n_count in blocks:
+                    row0, col0 = m_first * tile_m, n_first * tile_n
+                    c_blocks += [slab, row, row0, min(m, row0 + m_count * tile_m) - row0,
+                                 col0, min(n, col0 + n_count * tile_n) - col0]
+
+        header += [f'pb_l2_slab_t pb_slabs[{NUM_CLUSTERS}] = {{\n    '
+                   + ',\n    '.join(table) + '\n};']
+        header += [du.format_array_definition('uint32_t', 'pb_c_blocks',
+                                              np.array(c_blocks, dtype=np.uint32))]
+        return header
+
+    def emit_header(self, **kwargs):
+        pb_args = self.pop_pb_args(kwargs)
+        if kwargs.pop('tuned', 0):
+            self.apply_tuned_config(pb_args, kwargs)
+        self.validate_pb_config(pb_args, **kwargs)
+
+        self.validate_config(**kwargs)
+
+        # Same data as the Snitch generator, but A and C are only emitted in
+        # the slabs, the kernel deriving their addresses from `pb_slabs`
+        header = [super(GemmDataGen, self).emit_header()]
+        m, n, k = kwargs['m'], kwargs['n'], kwargs['k']
+        prec, _ = self.infer_implementation(kwargs['gemm_fp'])
+        ctype = du.ctype_from_precision_t(prec)
+        a = du.generate_random_array((m, k), prec, seed=42)
+        b = du.generate_random_array((k, n), prec, seed=42)
+        c = du.generate_random_array((m, n), prec, seed=42)
+        result = self.exact_golden_model(1, a, b, kwargs['beta'], c)
+        b = b.T if kwargs['transb'] else b
+
+        cfg = {'prec': prec, **kwargs, 'a': 'NULL', 'b': 'b', 'c': 'NULL'}
+        b = b.flatten()
+        header += [du.format_array_declaration(ctype, 'b', b.shape)]
+        header += [du.format_struct_definition('gemm_args_t', 'args', cfg)]
+        header += [du.format_array_definition(ctype, 'b', b, section=kwargs.get('section'))]
+        result_def = du.format_array_definition(ctype, 'result', result.flatten())
+        header += [du.format_ifdef_wrapper('BIST', result_def)]
+        header += [du.format_struct_definition('pb_gemm_args_t', 'pb_args', pb_args)]
+        header += self.emit_slabs(ctype, a, c, pb_args, **kwargs)
+        return '\n\n'.join(header)
+
+
+if __name__ == '__main__':
+    sys.exit(PbGemmDataGen().main())
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Offline tuner for the picobello `gemm_2d` app.
+#
+# For every problem shape, the tuner sweeps the tiling, buffering and
+# parallelization knobs, discarding the configurations rejected by the data
+# generator or exceeding the TCDM budget of a cluster. The remaining
+# configurations are ranked by the amount of data every cluster streams from
+# L2, and the most promising ones are built and simulated. The cycle count
+# of a run is the span between the first and the last `snrt_mcycle()` marker
+# in the performance traces of the Snitch cores.
+#
+# The best configuration of every shape is recorded in `data/tuned.json`.
+# When `tuned` is set, `datagen.py` applies the tuned configuration of the
+# problem shape to the parameters it emits.
+#
+# Example:
+#   tune.py --shape 128 32 16 64 --shape 256 256 64 32 --top 8
+
+import argparse
+import itertools
+import json
+import math
+import shlex
+import subprocess
+import sys
+from pathlib import Path
+
+import json5
+
+from datagen import PbGemmDataGen, PB_ROOT, TUNED_CONFIGS, NUM_CLUSTERS, MAX_NUM_BUFFERS, \
+    PB_CLUSTER_PER_ROW, PB_CLUSTER_PER_COL, PB_GEMM_CONFIG_SHAPE, PB_GEMM_CONFIG_KNOBS, \
+    gemm_prec, load_tuned_configs, tile_size
+
+APP_DIR = Path(__file__).resolve().parent.parent
+
+# Parallelization modes, as (parallelize_m, parallelize_n, parallelize_k)
+PARALLELIZATION_MODES = [(1, 0, 0), (0, 1, 0), (1, 1, 0), (0, 0, 1)]
+
+# Smallest tile size considered along any dimension
+MIN_TILE_SIZE = 8
+
+# TCDM reserved to the runtime, the stacks and the kernel arguments
+TCDM_RESERVED = 16 * 1024
+
+# TCDM bytes of the allocations of `gemm_picobello()` besides the tile
+# buffers: the copy of `gemm_args_t` (upper bound), the communicator
+# (`pb_comm_info_t`, see `pb_sync.h`), the DMA and compute counters, and the
+# flags of the mesh reduction
+GEMM_ARGS_SIZE = 128
+PB_COMM_INFO_SIZE = 16 * 4 + 2 * 32 * 8
+COUNTERS_SIZE = 2 * 4
+RX_FLAG_SIZE = 2 * 4
+
+# Alignment of the tile buffers in TCDM
+TCDM_ALIGN = 8
+
+DEFAULT_BUILD_CMD = ('make -C {root} sn-apps DEBUG=ON SN_BUILD_APPS=ON'
+                     ' gemm_2d_DATA_CFG={params}')
+DEFAULT_RUN_CMD = ('make -C {root} vsim-run-batch traces'
+                   ' CHS_BINARY={root}/sw/cheshire/tests/simple_offload.spm.elf'
+                   ' SN_BINARY={app}/build/gemm_2d.elf')
+
+
+def parser():
+    p = argparse.ArgumentParser(description='Tune the gemm_2d knobs for a set of shapes')
+    p.add_argument('--shape', nargs=4, type=int, action='append', required=True,
+                   metavar=('M', 'N', 'K', 'PREC'), help='Problem shape and precision in bits')
+    p.add_argument('--params', type=Path, default=APP_DIR / 'data/params.json',
+                   help='Parameters of the untuned knobs')
+    p.add_argument('--cluster-cfg', type=Path, default=PB_ROOT / 'cfg/snitch_cluster.json',
+                   help='Cluster configuration, providing the TCDM size')
+    p.add_argument('--output', type=Path, default=TUNED_CONFIGS,
+                   help='Tuned configurations, updated in place')
+    p.add_argument('--workdir', type=Path, default=APP_DIR / 'build/tune',
+                   help='Directory for the parameters and results of every run')
+    p.add_argument('--top', type=int, default=16,
+                   help='Number of configurations simulated per shape')
+    p.add_argument('--build-cmd', default=DEFAULT_BUILD_CMD,
+                   help='Command building the app with the parameters in {params}')
+    p.add_argument('--run-cmd', default=DEFAULT_RUN_CMD,
+                   help='Command simulating the app and generating the traces')
+    p.add_argument('--logs', type=Path, default=PB_ROOT / 'logs',
+                   help='Directory of the performance traces')
+    p.add_argument('--dry-run', action='store_true',
+                   help='Only list the configurations which would be simulated')
+    return p
+
+
+def tcdm_budget(cluster_cfg):
+    """TCDM bytes available to the tile buffers of a cluster."""
+    with open(cluster_cfg) as f:
+        cfg = json5.load(f)
+    return cfg['cluster']['tcdm']['size'] * 1024 - TCDM_RESERVED
+
+
+def tile_counts(size):
+    """Candidate numbers of tiles along a dimension of the given size."""
+    counts = {1}
+    counts |= {2**i for i in range(int(math.log2(size)) + 1)}
+    counts |= {NUM_CLUSTERS * i for i in range(1, size // NUM_CLUSTERS + 1)}
+    return sorted(t for t in counts if tile_size(size, t) >= MIN_TILE_SIZE or t == 1)
+
+
+def align(size, alignment=TCDM_ALIGN):
+    return (size + alignment - 1) // alignment * alignment
+
+
+def tcdm_footprint(cfg, prec):
+    """TCDM bytes allocated by `gemm_picobello()` for a configuration."""
+    tm = tile_size(cfg['m'], cfg['m_tiles'])
+    tn = tile_size(cfg['n'], cfg['n_tiles'])
+    tk = tile_size(cfg['k'], cfg['k_tiles'])
+    a, b, c = (align(size * prec) for size in [tm * tk, tk * tn, tm * tn])
+    num_buffers = cfg['num_buffers'] or (2 if cfg['double_buffer'] else 1)
+    footprint = GEMM_ARGS_SIZE + num_buffers * (a + b + c)
+    # Partial result buffer, reused as the first receive buffer of the mesh
+    # reduction, second receive buffer and flags
+    if cfg['parallelize_k']:
+        footprint += 2 * c + RX_FLAG_SIZE
+    return footprint + COUNTERS_SIZE + PB_COMM_INFO_SIZE
+
+
+def l2_traffic(cfg, prec):
+    """Bytes streamed from L2 by the busiest cluster, used to rank configurations."""
+    m_parts = PB_CLUSTER_PER_COL if cfg['parallelize_n'] else NUM_CLUSTERS
+    n_parts = PB_CLUSTER_PER_ROW if cfg['parallelize_m'] else NUM_CLUSTERS
+    m_parts = m_parts if cfg['parallelize_m'] else 1
+    n_parts = n_parts if cfg['parallelize_n'] else 1
+    k_parts = NUM_CLUSTERS if cfg['parallelize_k'] else 1
+    m_tiles = math.ceil(cfg['m_tiles'] / m_parts)
+    n_tiles = math.ceil(cfg['n_tiles'] / n_parts)
+    k_tiles = cfg['k_tiles'] // k_parts
+    tm = tile_size(cfg['m'], cfg['m_tiles'])
+    tn = tile_size(cfg['n'], cfg['n_tiles'])
+    tk = tile_size(cfg['k'], cfg['k_tiles'])
+    # A and B are reloaded for every tile, C once per (m, n) tile
+    a = m_tiles * n_tiles * k_tiles * tm * tk
+    b = m_tiles * n_tiles * k_tiles * tk * tn
+    c = 2 * m_tiles * n_tiles * tm * tn
+    # Shared operands are only fetched once per multicast group
+    if cfg['mcast'] and cfg['parallelize_n']:
+        a /= n_parts
+    if cfg['mcast'] and cfg['parallelize_m']:
+        b /= m_parts
+    # The mesh reduction moves one C tile per hop, over up to 3 + 3 hops
+    if cfg['parallelize_k']:
+        c += 6 * m_tiles * n_tiles * tm * tn
+    return (a + b + c) * prec
+
+
+def candidates(m, n, k, prec_bits, params, budget):
+    """Yield the configurations of a shape accepted by the data generator."""
+    datagen = PbGemmDataGen()
+    prec = prec_bits // 8
+    for (par_m, par_n, par_k), m_tiles, n_tiles, k_tiles, num_buffers, mcast in \
+            itertools.product(PARALLELIZATION_MODES, tile_counts(m), tile_counts(n),
+                              tile_counts(k), range(1, MAX_NUM_BUFFERS + 1), [0, 1]):
+        if mcast and par_k:
+            continue
+        cfg = {'m': m, 'n': n, 'k': k, 'prec': prec,
+               'm_tiles': m_tiles, 'n_tiles': n_tiles, 'k_tiles': k_tiles,
+               'parallelize_m': par_m, 'parallelize_k': par_k, 'parallelize_n': par_n,
+               'double_buffer': int(num_buffers > 1), 'partition_banks': 0,
+               'mcast': mcast, 'num_buffers': num_buffers, 'loop_order': 0}
+        if tcdm_footprint(cfg, prec) > budget:
+            continue
+        kwargs = {**params, **cfg}
+        del kwargs['prec']
+        pb_args = datagen.pop_pb_args(kwargs)
+        try:
+            datagen.validate_pb_config(pb_args, **kwargs)
+            datagen.validate_config(**kwargs)
+        except (ValueError, AssertionError):
+            continue
+        yield cfg
+
+
+def measure_cycles(logs):
+    """Span between the first and last `snrt_mcycle()` marker of all Snitch cores."""
+    tstart, tend = None, None
+    for trace in logs.glob('hart_*_perf.json'):
+        with open(trace) as f:
+            regions = json.load(f)
+        for region in regions:
+            if 'tstart' not in region or 'tend' not in region:
+                continue
+            tstart = region['tstart'] if tstart is None else min(tstart, region['tstart'])
+            tend = region['tend'] if tend is None else max(tend, region['tend'])
+    if tstart is None:
+        raise RuntimeError(f'No performance traces found in {logs}')
+    return tend - tstart
+
+
+def run(cfg, params, args, workdir):
+    """Build and simulate a configuration, returning its cycle count."""
+    workdir.mkdir(parents=True, exist_ok=True)
+    run_params = {**params, **{key: cfg[key] for key in PB_GEMM_CONFIG_KNOBS},
+                  'm': cfg['m'], 'n': cfg['n'], 'k': cfg['k'], 'tuned': 0}
+    params_file = workdir / 'params.json'
+    with open(params_file, 'w') as f:
+        json.dump(run_params, f, indent=4)
+    fmt = {'root': PB_ROOT, 'app': APP_DIR, 'params': params_file}
+    for cmd in [args.build_cmd, args.run_cmd]:
+        subprocess.run(shlex.split(cmd.format(**fmt)), check=True)
+    cycles = measure_cycles(args.logs)
+    with open(workdir / 'result.json', 'w') as f:
+        json.dump({**cfg, 'cycles': cycles}, f, indent=4)
+    return cycles
+
+
+def main():
+    args = parser().parse_args()
+    with open(args.params) as f:
+        params = json5.load(f)
+    budget = tcdm_budget(args.cluster_cfg)
+    tuned = load_tuned_configs(args.output)
+
+    for m, n, k, prec_bits in args.shape:
+        # Use a kernel of the requested precision
+        params['gemm_fp'] = params['gemm_fp'].replace(f'fp{gemm_prec(params["gemm_fp"])}',
+                                                      f'fp{prec_bits}', 1)
+        ranked = sorted(candidates(m, n, k, prec_bits, params, budget),
+                        key=lambda cfg: l2_traffic(cfg, cfg['prec']))[:args.top]
+        if not ranked:
+            print(f'No valid configuration for {m}x{n}x{k} FP{prec_bits}', file=sys.stderr)
+            continue
+
+        best = None
+        for i, cfg in enumerate(ranked):
+            if args.dry_run:
+                print(json.dumps(cfg))
+                continue
+            cycles = run(cfg, params, args, args.workdir / f'{m}x{n}x{k}_fp{prec_bits}' / str(i))
+            print(f'{m}x{n}x{k} FP{prec_bits} [{i}]: {cycles} cycles')
+            if best is None or cycles < best['cycles']:
+                best = {**cfg, 'cycles': cycles}
+        if best is None:
+            continue
+
+        # Replace the previous configuration of the shape
+        shape = [best[key] for key in PB_GEMM_CONFIG_SHAPE]
+        tuned = [cfg for cfg in tuned if [cfg[key] for key in PB_GEMM_CONFIG_SHAPE] != shape]
+        tuned.append(best)
+
+    if not args.dry_run:
+        with open(args.output, 'w') as f:
+            json.dump(tuned, f, indent=4)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Verification for the picobello `gemm_2d` app, based on the Snitch GEMM
+# verifier.
+
+import sys
+
+import numpy as np
+import snitch.util.sim.data_utils as du
+
+from datagen import load_sn_gemm_module
+
+GemmVerifier = load_sn_gemm_module('verify').GemmVerifier
+
+
+class PbGemmVerifier(GemmVerifier):
+
+    # A and C are only placed in the slabs of the memory tiles closest to the
+    # clusters (see `datagen.py`), and are gathered from the slabs holding the
+    # blocks of C listed in `pb_c_blocks`
+    def gather_slabs(self, name, cols, get, whole_rows):
+        ctype = du.ctype_from_precision_t(self.prec)
+        mat = np.zeros((self.func_args['m'], cols))
+        blocks = self.get_input_from_symbol('pb_c_blocks', 'uint32_t').reshape(-1, 6)
+        for slab, slab_row, row, rows, col, ncols in blocks:
+            data = get(f'{name}_slab_{slab}', ctype).reshape(-1, cols)
+            data = data[row - slab_row:row - slab_row + rows]
+            if whole_rows:
+                mat[row:row + rows] = data
+            else:
+                mat[row:row + rows, col:col + ncols] = data[:, col:col + ncols]
+        return mat.flatten()
+
+    def get_input_from_symbol(self, name, ctype):
+        if name == 'a':
+            return self.gather_slabs('a', self.func_args['k'], super().get_input_from_symbol,
+                                     True)
+        if name == 'c':
+            return self.gather_slabs('c', self.func_args['n'], super().get_input_from_symbol,
+                                     True)
+        return super().get_input_from_symbol(name, ctype)
+
+    def get_actual_results(self):
+        return self.gather_slabs('c', self.func_args['n'], self.get_output_from_symbol, False)
+
+
+if __name__ == '__main__':
+    sys.exit(PbGemmVerifier().main())
@@ -10,8 +10,7 @@
 
 // TODO (lleone): LIMITATIONS
 //
-// - Works only when M_tile = snrt_cluster_num()
-// - Works only if parallelized on M
+// - Parallelization on K can't be combined with parallelization on M or N
 
 #include "snrt.h"
 #include <stdalign.h>
@@ -19,8 +18,7 @@
 
 #include <math.h>
 #include "blas.h"
-
-// #define HW_MCAST
+#include "gemm_2d.h"
 
 // #define JOB_ARGS_PRELOADED
 
@@ -29,42 +27,259 @@
 #include "data.h"
 #pragma clang diagnostic pop
 
-// Allocate data in L2 to better map kernel in NoC system
-static inline void allocate_l2_buffers(gemm_args_t *largs ) {
+// Point A and C to the slabs placed by the linker in the memory tile closest
+// to the cluster. The slabs only hold the rows of A and C used by the
+// cluster, so the pointers are offset such that the tiles can still be
+// indexed with their absolute coordinates.
+static inline void use_l2_slabs(gemm_args_t *largs) {
+    const pb_l2_slab_t *slab = &pb_slabs[snrt_cluster_idx()];
+    largs->a = (void *)((uintptr_t)slab->a -
+                        slab->row * largs->lda * largs->prec);
+    largs->c = (void *)((uintptr_t)slab->c -
+                        slab->row * largs->ldc * largs->prec);
+}
 
-    uint32_t prec = largs->prec;
-    uint32_t mem_tile_idx = pb_closest_mem_tile(snrt_cluster_idx());
+// Multicast a tile buffer from the local TCDM to the same buffer in all the
+// clusters selected by `mask`. The transfer is addressed to `neighbour`, a
+// cluster other than the local one within the multicast group.
+static inline snrt_dma_txid_t mcast_tile(void *buf, size_t size,
+                                         uint32_t neighbour, uint32_t mask) {
+    void *dst = snrt_remote_l1_ptr(buf, snrt_cluster_idx(), neighbour);
+    return snrt_dma_start_1d_mcast(dst, buf, size, mask);
+}
 
-    uintptr_t a_off = pb_l2_tile_offset((uintptr_t) largs -> a);
-    uintptr_t c_off = pb_l2_tile_offset((uintptr_t) largs -> c);
-    uintptr_t a_dst = pb_l2_tile_address(mem_tile_idx) + a_off;
-    uintptr_t c_dst = pb_l2_tile_address(mem_tile_idx) + c_off;
+// Maximum number of tile buffers per operand
+#define MAX_NUM_BUFFERS 4
+
+// Position of the cluster collecting the result of a K-parallel GEMM. The
+// root is placed at the centre of the mesh to minimize the reduction depth.
+#define REDUCTION_ROOT_COL ((PB_CLUSTER_PER_ROW - 1) / 2)
+#define REDUCTION_ROOT_ROW ((PB_CLUSTER_PER_COL - 1) / 2)
+#define REDUCTION_ROOT_IDX \
+    (REDUCTION_ROOT_COL * PB_CLUSTER_PER_COL + REDUCTION_ROOT_ROW)
+
+// Mesh reduction state. Every cluster can receive a partial result from its
+// lower and its upper neighbour along a mesh dimension, in two separate
+// buffers. The arrival of a partial result is signalled by the sender
+// incrementing the corresponding counter in the receiver's TCDM.
+typedef struct {
+    void *rx[2];
+    volatile uint32_t *rx_flag;
+    uint32_t rx_count[2];
+} mesh_reduction_t;
+
+// Accumulate `src` into `dst`, splitting the work among the compute cores
+static inline void add_partial(void *dst, const void *src, uint32_t len,
+                               uint32_t prec) {
+    uint32_t core_idx = snrt_cluster_core_idx();
+    uint32_t num_cores = snrt_cluster_compute_core_num();
+    if (prec == FP64) {
+        for (uint32_t i = core_idx; i < len; i += num_cores)
+            ((double *)dst)[i] += ((const double *)src)[i];
+    } else {
+        for (uint32_t i = core_idx; i < len; i += num_cores)
+            ((float *)dst)[i] += ((const float *)src)[i];
+    }
+}
+
+// Reduce the partial results of the `n` clusters along one mesh dimension
+// into the cluster at position `root`. `pos` is the position of the local
+// cluster along the dimension, and `stride` the cluster index distance
+// between two neighbours. At every step, the outermost active clusters at
+// either end forward their partial result one hop towards the root, so that
+// every transfer only crosses a single link. The reduction completes in
+// max(root, n - 1 - root) steps.
+static inline void mesh_line_reduction(mesh_reduction_t *red, void *buf,
+                                       uint32_t len, uint32_t prec,
+                                       uint32_t pos, uint32_t n,
+                                       uint32_t root, uint32_t stride) {
+    uint32_t num_steps = (root > n - 1 - root) ? root : n - 1 - root;
+    for (uint32_t s = 0; s < num_steps; s++) {
+        // The lower and upper ends forward their partial result. The
+        // receiver accumulates partial results coming from below in
+        // buffer 0, and those coming from above in buffer 1.
+        int send_up = (pos == s) && (s < root);
+        int send_down = (pos == n - 1 - s) && (pos > root);
+        if ((send_up || send_down) && snrt_is_dm_core()) {
+            uint32_t dir = send_up ? 0 : 1;
+            uint32_t dst = send_up ? snrt_cluster_idx() + stride
+                                   : snrt_cluster_idx() - stride;
+            snrt_dma_start_1d(
+                snrt_remote_l1_ptr(red->rx[dir], snrt_cluster_idx(), dst),
+                buf, len * prec);
+            snrt_dma_wait_all();
+            __atomic_add_fetch(
+                (volatile uint32_t *)snrt_remote_l1_ptr(
+                    (void *)&red->rx_flag[dir], snrt_cluster_idx(), dst),
+                1, __ATOMIC_RELAXED);
+        }
+
+        // Accumulate the partial results received in this step
+        int recv[2];
+        recv[0] = (pos == s + 1) && (s < root);
+        recv[1] = (pos + s + 2 == n) && (n - 1 - s > root);
+        for (uint32_t dir = 0; dir < 2; dir++) {
+            if (!recv[dir]) continue;
+            red->rx_count[dir]++;
+            if (!snrt_is_dm_core()) {
+                while (red->rx_flag[dir] < red->rx_count[dir])
+                    ;
+                add_partial(buf, red->rx[dir], len, prec);
+            }
+        }
 
-    // Move data in the correct memory tile location
-    uint32_t size_a = (size_t)largs->m * (size_t)largs->k;
-    uint32_t size_c = (size_t)largs->m * (size_t)largs->n;
-    snrt_dma_start_1d((void *) a_dst, (void *) largs->a, size_a * prec);
-    snrt_dma_start_1d((void *) c_dst, (void *) largs->c, size_c * prec);
+        // The accumulated result must be complete before forwarding it
+        snrt_cluster_hw_barrier();
+    }
+}
 
-    // Update A and C local pointer to the relocated memory tile address
-    largs->a = (void *) a_dst;
-    largs->c = (void *) c_dst;
+// Reduce the partial results of all clusters into the reduction root,
+// first along the mesh rows and then along the root column.
+static inline void mesh_reduction(mesh_reduction_t *red, void *buf,
+                                  uint32_t len, uint32_t prec,
+                                  pb_comm_t comm) {
+    mesh_line_reduction(red, buf, len, prec, pb_cluster_col(),
+                        PB_CLUSTER_PER_ROW, REDUCTION_ROOT_COL,
+                        PB_CLUSTER_PER_COL);
+
+    // The receive buffers are reused by the column reduction
+    pb_global_barrier(comm);
+
+    if (pb_cluster_col() == REDUCTION_ROOT_COL) {
+        mesh_line_reduction(red, buf, len, prec, pb_cluster_row(),
+                            PB_CLUSTER_PER_COL, REDUCTION_ROOT_ROW, 1);
+    }
 }
 
-// Write back C tiles in original memory tile for verification purposes
-static inline void write_back_c_tiles(gemm_args_t* largs, uint32_t m_tile_size,
-                                      uint32_t n_tile_size) {
-    uintptr_t c_src, c_dst;
-    uint32_t transfer_size;
-    int c_m_abs, c_n_abs;
+// Loop orders over the tiles of a cluster, named from the innermost to the
+// outermost loop
+#define LOOP_ORDER_AUTO 0
+#define LOOP_ORDER_KNM 1
+#define LOOP_ORDER_NKM 2
+
+// Tiles assigned to a cluster. Tiles are either assigned as a block of
+// `m_tiles` x `n_tiles` tiles starting at (`m_first`, `n_first`), or, if
+// `flat`, as a contiguous range of (m, n) tiles starting at `first_item`, in
+// row-major order over a grid of `n_tiles` N tiles.
+typedef struct {
+    uint32_t flat;
+    uint32_t loop_order;
+    uint32_t m_first;
+    uint32_t n_first;
+    uint32_t first_item;
+    uint32_t n_tiles;
+    uint32_t k_tiles;
+} tile_schedule_t;
+
+// Get the coordinates of the `i`-th tile of a cluster, iterating in the
+// loop order of the schedule. The m and n coordinates are absolute, while k
+// is relative to the first K tile of the cluster.
+static inline void tile_coords(const tile_schedule_t *sched, int i, int *m,
+                               int *n, int *k) {
+    int n_tiles = sched->n_tiles;
+    int k_tiles = sched->k_tiles;
+    if (sched->flat) {
+        int item = sched->first_item + i / k_tiles;
+        *k = i % k_tiles;
+        *n = item % n_tiles;
+        *m = item / n_tiles;
+    } else if (sched->loop_order == LOOP_ORDER_NKM) {
+        *n = i % n_tiles + sched->n_first;
+        *k = (i / n_tiles) % k_tiles;
+        *m = i / (n_tiles * k_tiles) + sched->m_first;
+    } else {
+        *k = i % k_tiles;
+        *n = (i / k_tiles) % n_tiles + sched->n_first;
+        *m = i / (k_tiles * n_tiles) + sched->m_first;
+    }
+}
 
+// Size of the `idx`-th tile along a dimension of size `size`, tiled with
+// tiles of size `tile_size`. Only the last tile can be smaller.
+static inline uint32_t tile_extent(uint32_t idx, uint32_t tile_size,
+                                   uint32_t size) {
+    uint32_t remaining = size - idx * tile_size;
+    return remaining < tile_size ? remaining : tile_size;
+}
 
-    // Position of the first element in the Tile to be written back
-    c_src = (uintptr_t )largs->c + (snrt_cluster_idx() * largs->n * m_tile_size) * largs->prec;
-    c_dst = pb_l2_tile_address(0) + pb_l2_tile_offset( (uintptr_t) c_src);
-    transfer_size = m_tile_size * largs->n * largs->prec;
+// Load the `rows` x `cols` tile at element (`row`, `col`) of a row-major
+// matrix with leading dimension `ld` into a contiguous buffer
+static inline snrt_dma_txid_t load_tile(void *dst, const void *src,
+                                        uint32_t row, uint32_t col,
+                                        uint32_t rows, uint32_t cols,
+                                        uint32_t ld, uint32_t prec) {
+    return snrt_dma_start_2d(
+        dst, (const void *)((uintptr_t)src + (row * ld + col) * prec),
+        cols * prec, cols * prec, ld * prec, rows);
+}
 
-    if (c_src != c_dst) snrt_dma_start_1d((void *) c_dst, (void *) c_src, transfer_size);
+// Store a contiguous `rows` x `cols` tile at element (`row`, `col`) of a
+// row-major matrix with leading dimension `ld`
+static inline snrt_dma_txid_t store_tile(void *dst, const void *src,
+                                         uint32_t row, uint32_t col,
+                                         uint32_t rows, uint32_t cols,
+                                         uint32_t ld, uint32_t prec) {
+    return snrt_dma_start_2d(
+        (void *)((uintptr_t)dst + (row * ld + col) * prec), src,
+        cols * prec, ld * prec, cols * prec, rows);
+}
+
+// Ring of tile buffers of an operand. The ring only advances to the next
+// buffer when the operand tile changes from one iteration to the next, so
+// that a tile used by consecutive iterations stays resident in TCDM.
+typedef struct {
+    int tile;
+    uint32_t num_tiles;
+    uint32_t buf;
+} tile_ring_t;
+
+// Advance the ring to `tile`. Returns whether the tile is not resident and
+// was assigned a new buffer.
+static inline int tile_ring_advance(tile_ring_t *ring, int tile,
+                                    uint32_t num_buffers) {
+    if (ring->num_tiles && ring->tile == tile) return 0;
+    ring->buf = ring->num_tiles % num_buffers;
+    ring->num_tiles++;
+    ring->tile = tile;
+    return 1;
+}
+
+// Compute a tile on the cluster's RedMulE and wait for its completion.
+// Following the RedMulE convention Z[M x K] = X[M x N] * W[N x K] (+ Y), the
+// A tile is X, the B tile is W, and the C tile is both Y and Z, so a GEMM
+// tile of size (m, n, k) is a RedMulE job of size (m, k, n).
+static inline void redmule_tile(void *a, void *b, void *c, uint32_t m,
+                                uint32_t n, uint32_t k, uint32_t beta,
+                                uint32_t prec) {
+    while (redmule_acquire_job() < 0)
+        ;
+    redmule_cfg((unsigned int)a, (unsigned int)b, (unsigned int)c, m, k, n,
+                (uint8_t)(beta ? REDMULE_GEMM : REDMULE_MATMUL),
+                (uint8_t)(prec == FP16 ? REDMULE_Float16 : REDMULE_Float8));
+    redmule_trigger_job();
+    while (redmule_get_status() != 0) snrt_wfi();
+    redmule_evt_clear(1 << snrt_cluster_core_idx());
+}
+
+// Wait until the compute cores of the cluster have completed `num_tiles`
+// tiles. Every compute core increments `tiles_computed` once per tile.
+static inline void wait_tiles_computed(volatile uint32_t *tiles_computed,
+                                       uint32_t num_tiles) {
+    uint32_t target = num_tiles * snrt_cluster_compute_core_num();
+    while (*tiles_computed < target)
+        ;
+}
+
+// Distribute `num_tiles` tiles over `num_parts` parts as evenly as possible.
+// Returns the number of tiles assigned to part `part_idx` and the index of
+// its first tile.
+static inline void distribute_tiles(uint32_t num_tiles, uint32_t num_parts,
+                                    uint32_t part_idx, uint32_t *count,
+                                    uint32_t *first) {
+    uint32_t quotient = num_tiles / num_parts;
+    uint32_t remainder = num_tiles % num_parts;
+    *count = quotient + (part_idx < remainder);
+    *first = part_idx * quotient + (part_idx < remainder ? part_idx : remainder);
 }
 
 /**
@@ -74,6 +289,8 @@ static inline void write_back_c_tiles(gemm_args_t* largs, uint32_t m_tile_size,
  *
  * @param args Pointer to a `gemm_args_t` structure containing arguments
  *             for the GEMM operation.
+ * @param pb_args Pointer to a `pb_gemm_args_t` structure containing the
+ *                picobello-specific arguments.
  *
  * @details
  * The function performs the following steps:
@@ -85,14 +302,18 @@ static inline void write_back_c_tiles(gemm_args_t* largs, uint32_t m_tile_size,
  * 5. Iterates over the tiles, performing the following:
  *    - Copies data for the current tile into local memory.
  *    - Performs the tile computation using the `sc_st_gemm` function.
- *    - Performs a logarithmic reduction to combine partial results across
+ *    - Performs a reduction over the mesh to combine partial results across
  *      clusters, if `parallelize_k` is enabled.
  *    - Writes the result back to global memory.
  *
- * @note Current implementation assumes that `parallelize_m` and
- *       `parallelize_k` options are mutually exclusive.
+ * @note Current implementation assumes that `parallelize_k` is mutually
+ *       exclusive with both `parallelize_m` and `parallelize_n`.
  */
-static inline int gemm_picobello(const gemm_args_t *args) {
+static inline int gemm_picobello(const gemm_args_t *args,
+                                 const pb_gemm_args_t *pb_args) {
+    // Picobello-specific arguments are few, keep them in registers
+    pb_gemm_args_t pargs = *pb_args;
+
 #ifndef JOB_ARGS_PRELOADED
     // Copy the arguments to local memory
     gemm_args_t *largs = (gemm_args_t *)snrt_l1_alloc_cluster_local(
@@ -106,20 +327,50 @@ static inline int gemm_picobello(const gemm_args_t *args) {
     const gemm_args_t *largs = args;
 #endif
 
-    // Calculate tile sizes
-    uint32_t tile_m = largs->m / largs->m_tiles;
-    uint32_t tile_n = largs->n / largs->n_tiles;
-    uint32_t tile_k = largs->k / largs->k_tiles;
+    // Dispatch tiles to RedMulE rather than computing them on the cores
+    uint32_t use_redmule = pargs.use_redmule;
+    if (use_redmule && snrt_cluster_core_idx() == 0) {
+        redmule_cg_enable();
+        redmule_soft_clear();
+        snrt_interrupt_enable(IRQ_M_ACC);
+    }
+
+    // Calculate tile sizes. If a dimension is not a multiple of its number
+    // of tiles, the last tile along that dimension is smaller (ragged).
+    // Buffers are sized for a full tile, and ragged tiles are stored
+    // contiguously in them.
+    uint32_t tile_m = (largs->m + largs->m_tiles - 1) / largs->m_tiles;
+    uint32_t tile_n = (largs->n + largs->n_tiles - 1) / largs->n_tiles;
+    uint32_t tile_k = (largs->k + largs->k_tiles - 1) / largs->k_tiles;
     uint32_t tile_a_size = tile_m * tile_k * largs->prec;
     uint32_t tile_b_size = tile_k * tile_n * largs->prec;
     uint32_t tile_c_size = tile_m * tile_n * largs->prec;
 
+    // Number of buffers per operand, i.e. pipeline depth. Tile i is loaded
+    // into buffer i % num_buffers, so the loads of the next num_buffers - 1
+    // tiles can be in flight while a tile is computed.
+    uint32_t num_buffers = pargs.num_buffers;
+    if (!num_buffers) num_buffers = largs->double_buffer ? 2 : 1;
+
     // Allocate space for local tile buffers in TCDM, unless preloaded
     void *a0, *a1, *b0, *b1, *c0, *c1;
-    void *la[2], *lb[2], *lc[2], *lcr;
+    void *la[MAX_NUM_BUFFERS], *lb[MAX_NUM_BUFFERS], *lc[MAX_NUM_BUFFERS], *lcr;
     int banks_per_buffer = snrt_cluster_compute_core_num();
     allocate_buffers(tile_a_size, tile_b_size, tile_c_size, largs,
                      banks_per_buffer, la, lb, lc, &lcr);
+    // Buffers beyond the first two are only supported with contiguous
+    // (non-partitioned) buffers, which is checked by the data generator
+    for (uint32_t j = 2; j < num_buffers; j++) {
+        la[j] = largs->load_a ? snrt_l1_alloc_cluster_local(tile_a_size,
+                                                            sizeof(double))
+                              : la[0];
+        lb[j] = largs->load_b ? snrt_l1_alloc_cluster_local(tile_b_size,
+                                                            sizeof(double))
+                              : lb[0];
+        lc[j] = largs->load_c ? snrt_l1_alloc_cluster_local(tile_c_size,
+                                                            sizeof(double))
+                              : lc[0];
+    }
     if (snrt_cluster_core_idx() == 0) {
         DUMP(la[0]);
         DUMP(la[1]);
@@ -128,6 +379,34 @@ static inline int gemm_picobello(const gemm_args_t *args) {
         DUMP(lc[0]);
         DUMP(lc[1]);
     }
+
+    // Allocate the receive buffers and flags for the mesh reduction. The
+    // buffer `allocate_buffers()` reserves for the partial result of a
+    // K-parallel GEMM serves as the first receive buffer.
+    mesh_reduction_t red;
+    if (largs->parallelize_k) {
+        red.rx[0] = lcr;
+        red.rx[1] = snrt_l1_alloc_cluster_local(tile_c_size, sizeof(double));
+        red.rx_flag = (volatile uint32_t *)snrt_l1_alloc_cluster_local(
+            2 * sizeof(uint32_t), sizeof(uint32_t));
+        red.rx_count[0] = 0;
+        red.rx_count[1] = 0;
+        if (snrt_is_dm_core()) {
+            red.rx_flag[0] = 0;
+            red.rx_flag[1] = 0;
+        }
+    }
+
+    // Allocate the counters for the point-to-point synchronization between
+    // DMA and compute cores
+    volatile uint32_t *tiles_loaded = (volatile uint32_t *)
+        snrt_l1_alloc_cluster_local(sizeof(uint32_t), sizeof(uint32_t));
+    volatile uint32_t *tiles_computed = (volatile uint32_t *)
+        snrt_l1_alloc_cluster_local(sizeof(uint32_t), sizeof(uint32_t));
+    if (snrt_is_dm_core()) {
+        *tiles_loaded = 0;
+        *tiles_computed = 0;
+    }
     snrt_cluster_hw_barrier();
 
     // NoC layout (6 columns x 4 rows)
@@ -154,8 +433,7 @@ static inline int gemm_picobello(const gemm_args_t *args) {
     //
     */
 
-    // Use the DMA core of cluster 0 to place all data in the correct positions
-    // so the problem becomes NoC-optimized.
+    // Data is placed in the memory tiles so the problem becomes NoC-optimized.
     //
     // Case: parallelization over M, with tiling along both M and N.
     // - Each cluster processes a set of rows of A:
@@ -169,83 +447,220 @@ static inline int gemm_picobello(const gemm_args_t *args) {
     //   * The first half of the clusters load A from the memory tiles on the left [tile 0 - 3].
     //   * The second half of the clusters load A from the memory tiles on the right [tile 4 - 7].
     // - The same scheme is used to store the corresponding tile of C.
+    // - The data generator emits the rows of A and C used by every cluster in
+    //   the linker section of its closest memory tile (`pb_slabs`), so no data
+    //   needs to be moved before or after the kernel.
     // - Matrix B is stored entirely in the first memory tile.
     //   * Since all clusters need access to B, its exact location does not affect
     //     performance significantly.
     //
-    // Notes:
-    // - All data movement to arrange memory tiles is performed before measuring
-    //   kernel execution time.
-    // - With a proper linker script, data could be placed directly in the correct
-    //   memory tiles without requiring extra DMA work from cluster 0.
-
-    // Distribute m and k tiles to clusters
-    uint32_t cluster_m_tiles = largs->m_tiles;
+    // Case: 2D parallelization over M and N (`parallelize_m` and
+    // `parallelize_n`).
+    // - The cluster mesh is mapped onto a 2D block decomposition of C.
+    // - Clusters in the same mesh row compute the same rows of C, and thus
+    //   share the same panel of A.
+    // - Clusters in the same mesh column compute the same columns of C, and
+    //   thus share the same panel of B.
+    // - Since the A panel of a mesh row is placed in the memory tiles of that
+    //   same row, A never travels along the Y dimension. Every cluster
+    //   only streams 1/sqrt(P) of A and B.
+
+    // Map clusters onto blocks of M and N tiles
+    uint32_t m_parts = 1, m_part_idx = 0;
+    uint32_t n_parts = 1, n_part_idx = 0;
+    if (largs->parallelize_m && pargs.parallelize_n) {
+        m_parts = PB_CLUSTER_PER_COL;
+        m_part_idx = pb_cluster_row();
+        n_parts = PB_CLUSTER_PER_ROW;
+        n_part_idx = pb_cluster_col();
+    } else if (largs->parallelize_m) {
+        m_parts = snrt_cluster_num();
+        m_part_idx = snrt_cluster_idx();
+    } else if (pargs.parallelize_n) {
+        n_parts = snrt_cluster_num();
+        n_part_idx = snrt_cluster_idx();
+    }
+
+    // Distribute m, n and k tiles to clusters
+    uint32_t cluster_m_tiles, cluster_m_first;
+    uint32_t cluster_n_tiles, cluster_n_first;
     uint32_t cluster_k_tiles = largs->k_tiles;
+    distribute_tiles(largs->m_tiles, m_parts, m_part_idx, &cluster_m_tiles,
+                     &cluster_m_first);
+    distribute_tiles(largs->n_tiles, n_parts, n_part_idx, &cluster_n_tiles,
+                     &cluster_n_first);
+    if (largs->parallelize_k) cluster_k_tiles /= snrt_cluster_num();
+
+    // In 1D modes, if the tiles of the parallelized dimension can't be evenly
+    // distributed, clusters are instead assigned a contiguous range of (m, n)
+    // tiles, so that the load imbalance is at most one (m, n) tile rather
+    // than a whole row or column of tiles. The blocks are kept when clusters
+    // must process the same tiles in lockstep to share them (`mcast`).
+    uint32_t num_items = largs->m_tiles * largs->n_tiles;
+    uint32_t flat = (largs->parallelize_m != pargs.parallelize_n) &&
+                    !pargs.mcast &&
+                    ((largs->m_tiles % m_parts) || (largs->n_tiles % n_parts));
+    uint32_t cluster_items = 0, cluster_first_item = 0;
+    if (flat) {
+        distribute_tiles(num_items, snrt_cluster_num(), snrt_cluster_idx(),
+                         &cluster_items, &cluster_first_item);
+    }
+
+    // In 1D modes, idle clusters are the last ones and can be left out of the
+    // communicator. In 2D mode, idle clusters are not contiguous, so all
+    // clusters take part in the synchronization.
     uint32_t num_working_clusters = snrt_cluster_num();
-    if (largs->parallelize_m) {
-        uint32_t m_tiles_quotient = cluster_m_tiles / snrt_cluster_num();
-        uint32_t m_tiles_remainder = cluster_m_tiles % snrt_cluster_num();
-        cluster_m_tiles = m_tiles_quotient;
-        if (snrt_cluster_idx() < m_tiles_remainder) cluster_m_tiles++;
-        if (m_tiles_quotient == 0) num_working_clusters = m_tiles_remainder;
+    if (flat) {
+        if (num_items < snrt_cluster_num()) num_working_clusters = num_items;
+    } else if (largs->parallelize_m && !pargs.parallelize_n &&
+               largs->m_tiles < snrt_cluster_num()) {
+        num_working_clusters = largs->m_tiles;
+    } else if (pargs.parallelize_n && !largs->parallelize_m &&
+               largs->n_tiles < snrt_cluster_num()) {
+        num_working_clusters = largs->n_tiles;
     }
-    if (largs->parallelize_k) cluster_k_tiles /= snrt_cluster_num();
 
-    snrt_comm_t comm;
-    snrt_comm_create(num_working_clusters, &comm);
-
-    // Calculate number of iterations
-    uint32_t num_tiles = cluster_m_tiles * largs->n_tiles * cluster_k_tiles;
-    uint32_t num_iters = num_tiles;
-    if (largs->double_buffer)
-        num_iters += 2;
-    else
-        num_iters += 1;
-
-    // Place data in the correct memory tile pre-kernel.
-    // TODO (lleone): Improve copying only the necessary information and not the full data stack
-    if (snrt_is_dm_core())
-    {
-        allocate_l2_buffers(largs);
-        snrt_dma_wait_all();
+    // Synchronize the working clusters with a row-then-column barrier
+    pb_comm_t comm;
+    uint32_t members = (uint32_t)((1ull << num_working_clusters) - 1);
+    pb_comm_create(members, PB_BARRIER_HIERARCHICAL, &comm);
+
+    // Clusters sharing an operand can fetch it once from L2 and multicast it
+    // over the NoC (`mcast`):
+    // - In 2D mode, the head of every row (column 0) multicasts A along its
+    //   row, and the head of every column (row 0) multicasts B down its
+    //   column.
+    // - In 1D modes, cluster 0 multicasts the shared operand to all clusters.
+    // The heads must process the same tiles as the rest of their group, so
+    // multicasting A requires N tiles to be evenly distributed.
+    // Partitioned-bank buffers are not contiguous and can't be multicast.
+    uint32_t mcast_a = pargs.mcast && pargs.parallelize_n &&
+                       !largs->partition_banks &&
+                       (largs->n_tiles % n_parts) == 0;
+    uint32_t mcast_b = pargs.mcast && largs->parallelize_m &&
+                       !largs->partition_banks;
+    uint32_t is_a_head, a_neighbour, a_mask;
+    uint32_t is_b_head, b_neighbour, b_mask;
+    if (largs->parallelize_m && pargs.parallelize_n) {
+        is_a_head = pb_cluster_col() == 0;
+        a_neighbour = snrt_cluster_idx() + PB_CLUSTER_PER_COL;
+        a_mask = pb_mcast_row_mask();
+        is_b_head = pb_cluster_row() == 0;
+        b_neighbour = snrt_cluster_idx() + 1;
+        b_mask = pb_mcast_col_mask();
+    } else {
+        is_a_head = is_b_head = snrt_cluster_idx() == 0;
+        a_neighbour = b_neighbour = 1;
+        a_mask = b_mask = pb_mcast_row_mask() | pb_mcast_col_mask();
+    }
+    uint32_t fetch_a = !mcast_a || is_a_head;
+    uint32_t fetch_b = !mcast_b || is_b_head;
+
+    // Clusters only need to synchronize with each other when they exchange
+    // data, i.e. for multicasts and reductions. Otherwise, the DMA and
+    // compute cores of every cluster synchronize point-to-point through two
+    // monotonic counters in TCDM: the DMA core publishes the number of tiles
+    // loaded, and every compute core increments the number of tiles computed
+    // once done with a tile. The DMA core can thus run ahead of the compute
+    // cores as long as buffers are available, and no cluster waits for the
+    // slowest one.
+    uint32_t global_sync = mcast_a || mcast_b || largs->parallelize_k;
+
+    // Calculate number of iterations. All clusters must iterate the same
+    // number of times to take part in the same barriers, so the number of
+    // iterations is derived from the largest tile count across clusters.
+    uint32_t num_tiles = cluster_m_tiles * cluster_n_tiles * cluster_k_tiles;
+    uint32_t max_cluster_m_tiles = (largs->m_tiles + m_parts - 1) / m_parts;
+    uint32_t max_cluster_n_tiles = (largs->n_tiles + n_parts - 1) / n_parts;
+    uint32_t num_iters =
+        max_cluster_m_tiles * max_cluster_n_tiles * cluster_k_tiles;
+    if (flat) {
+        num_tiles = cluster_items * cluster_k_tiles;
+        num_iters = ((num_items + snrt_cluster_num() - 1) / snrt_cluster_num()) *
+                    cluster_k_tiles;
+    }
+    num_iters += num_buffers;
+
+    // Choose the loop order. Iterating K innermost (k-n-m) keeps C resident
+    // over the K loop, but reloads A for every N tile. Iterating N innermost
+    // (n-k-m) keeps A resident over the N loop, but C must be stored and
+    // reloaded for every K tile. The order moving the fewest bytes is
+    // selected: n-k-m saves (Nt - 1) * Kt A tiles per M tile, at the cost of
+    // 2 * Nt * (Kt - 1) extra C tile transfers.
+    // n-k-m requires C to be stored before it is reloaded, i.e. at least as
+    // many N tiles as buffers in every working cluster, each cluster to own
+    // its C tiles, and a block of tiles to iterate over.
+    uint32_t loop_order = pargs.loop_order;
+    uint32_t min_cluster_n_tiles = largs->n_tiles / n_parts;
+    if (!min_cluster_n_tiles) min_cluster_n_tiles = max_cluster_n_tiles;
+    uint32_t nkm_supported = !largs->parallelize_k && largs->load_c &&
+                             !largs->partition_banks && !flat &&
+                             min_cluster_n_tiles >= num_buffers;
+    if (loop_order == LOOP_ORDER_AUTO) {
+        uint32_t a_saved = (max_cluster_n_tiles - 1) * cluster_k_tiles *
+                           tile_a_size;
+        uint32_t c_extra = 2 * max_cluster_n_tiles * (cluster_k_tiles - 1) *
+                           tile_c_size;
+        loop_order = (nkm_supported && a_saved > c_extra) ? LOOP_ORDER_NKM
+                                                          : LOOP_ORDER_KNM;
+    } else if (!nkm_supported) {
+        loop_order = LOOP_ORDER_KNM;
     }
-    snrt_global_barrier(comm);
+    tile_schedule_t sched;
+    sched.flat = flat;
+    sched.loop_order = loop_order;
+    sched.m_first = cluster_m_first;
+    sched.n_first = cluster_n_first;
+    sched.first_item = cluster_first_item;
+    sched.n_tiles = flat ? largs->n_tiles : cluster_n_tiles;
+    sched.k_tiles = cluster_k_tiles;
+
+    // Buffer rings of the operands, as seen by the DMA-in, compute and
+    // DMA-out phases, and the last tile using each buffer
+    tile_ring_t a_in = {0}, b_in = {0}, c_in = {0};
+    tile_ring_t a_comp = {0}, b_comp = {0}, c_comp = {0};
+    tile_ring_t c_out = {0};
+    int a_last_use[MAX_NUM_BUFFERS], b_last_use[MAX_NUM_BUFFERS],
+        c_last_use[MAX_NUM_BUFFERS];
+    for (uint32_t j = 0; j < MAX_NUM_BUFFERS; j++) {
+        a_last_use[j] = -1;
+        b_last_use[j] = -1;
+        c_last_use[j] = -1;
+    }
+
+    // Transfer IDs of the C stores which may still be reading a C buffer
+    snrt_dma_txid_t c_store_txid[MAX_NUM_BUFFERS];
+    uint32_t c_store_pending[MAX_NUM_BUFFERS] = {0};
+    snrt_dma_txid_t last_c_store_txid = 0;
 
+    // Use the data placed in the closest memory tile
+    if (snrt_is_dm_core()) use_l2_slabs(largs);
 
+    // Clusters must have initialized their flags before they are accessed
+    // remotely
+    pb_global_barrier(comm);
 
     // Iterate over all tiles
     for (uint32_t i = 0; i < num_iters; i++) {
-        // Calculate tile indices (we iterate in k->n->m order)
+        // Calculate tile indices (in the selected loop order).
+        // The tile computed in this iteration was loaded num_buffers - 1
+        // iterations earlier, and is stored in the following iteration.
         int dma_in_i = i;
-        int comp_i = largs->double_buffer ? i - 1 : i;
-        int dma_out_i = largs->double_buffer ? i - 2 : i - 1;
-        int dma_in_k = dma_in_i % cluster_k_tiles;
-        int dma_in_mn = dma_in_i / cluster_k_tiles;
-        int dma_in_n = dma_in_mn % largs->n_tiles;
-        int dma_in_m = dma_in_mn / largs->n_tiles;
-        int comp_k = comp_i % cluster_k_tiles;
-        int comp_mn = comp_i / cluster_k_tiles;
-        int comp_n = comp_mn % largs->n_tiles;
-        int comp_m = comp_mn / largs->n_tiles;
-        int dma_out_k = dma_out_i % cluster_k_tiles;
-        int dma_out_mn = dma_out_i / cluster_k_tiles;
-        int dma_out_n = dma_out_mn % largs->n_tiles;
-        int dma_out_m = dma_out_mn / largs->n_tiles;
-
-        // If m and k tiles are parallelized across clusters,
-        // calculate the absolute m and k indices for each cluster
-        int dma_in_m_abs = dma_in_m;
-        int comp_m_abs = comp_m;
-        int dma_out_m_abs = dma_out_m;
+        int comp_i = i - (num_buffers - 1);
+        int dma_out_i = i - num_buffers;
+        int dma_in_m_abs, dma_in_n_abs, dma_in_k;
+        int comp_m_abs, comp_n_abs, comp_k;
+        int dma_out_m_abs, dma_out_n_abs, dma_out_k;
+        tile_coords(&sched, dma_in_i, &dma_in_m_abs, &dma_in_n_abs, &dma_in_k);
+        tile_coords(&sched, comp_i, &comp_m_abs, &comp_n_abs, &comp_k);
+        tile_coords(&sched, dma_out_i, &dma_out_m_abs, &dma_out_n_abs,
+                    &dma_out_k);
+
+        // If k tiles are parallelized across clusters, calculate the
+        // absolute k indices for each cluster
         int dma_in_k_abs = dma_in_k;
         int comp_k_abs = comp_k;
         int dma_out_k_abs = dma_out_k;
-        if (largs->parallelize_m) {
-            dma_in_m_abs += snrt_cluster_idx() * cluster_m_tiles;
-            comp_m_abs += snrt_cluster_idx() * cluster_m_tiles;
-            dma_out_m_abs += snrt_cluster_idx() * cluster_m_tiles;
-        }
         if (largs->parallelize_k) {
             dma_in_k_abs += snrt_cluster_idx() * cluster_k_tiles;
             comp_k_abs += snrt_cluster_idx() * cluster_k_tiles;
@@ -259,31 +674,60 @@ static inline int gemm_picobello(const gemm_args_t *args) {
         uint32_t comp_k_beta = comp_k_abs == 0 ? largs->beta : 1;
         uint32_t dma_in_k_beta = dma_in_k_abs == 0 ? largs->beta : 1;
 
+        // Size of the tiles, which can be ragged at the edges
+        uint32_t dma_in_tm = tile_extent(dma_in_m_abs, tile_m, largs->m);
+        uint32_t dma_in_tn = tile_extent(dma_in_n_abs, tile_n, largs->n);
+        uint32_t dma_in_tk = tile_extent(dma_in_k_abs, tile_k, largs->k);
+        uint32_t comp_tm = tile_extent(comp_m_abs, tile_m, largs->m);
+        uint32_t comp_tn = tile_extent(comp_n_abs, tile_n, largs->n);
+        uint32_t comp_tk = tile_extent(comp_k_abs, tile_k, largs->k);
+        uint32_t dma_out_tm = tile_extent(dma_out_m_abs, tile_m, largs->m);
+        uint32_t dma_out_tn = tile_extent(dma_out_n_abs, tile_n, largs->n);
+
         // DMA out phase
         if (snrt_is_dm_core()) {
-            if (dma_out_i >= 0) {
-                snrt_mcycle();
+            if (dma_out_i >= 0 && dma_out_i < num_tiles) {
                 // Switch buffers
-                int buff_idx = largs->double_buffer ? dma_out_mn % 2 : 0;
-
-                // Store C
-                // If parallelize_k, then only cluster 0 must writeback
-                if ((snrt_cluster_idx() == 0) || !(largs->parallelize_k)) {
+                tile_ring_advance(&c_out, dma_out_m_abs * largs->n_tiles +
+                                              dma_out_n_abs, num_buffers);
+
+                // Store C only when it is evicted, i.e. when the next tile
+                // accumulates on a different C tile. In k-n-m order, this
+                // only happens once C is fully accumulated over the K loop.
+                // The store is not waited for: it proceeds in the background
+                // while the next tiles are loaded, and is only waited for
+                // before the C buffer is reused.
+                // If parallelize_k, then only the reduction root must writeback
+                int next_m, next_n, next_k;
+                tile_coords(&sched, dma_out_i + 1, &next_m, &next_n, &next_k);
+                int evict_c = (dma_out_i + 1 == num_tiles) ||
+                              (next_m != dma_out_m_abs) ||
+                              (next_n != dma_out_n_abs);
+                if (evict_c && ((snrt_cluster_idx() == REDUCTION_ROOT_IDX) ||
+                                !(largs->parallelize_k))) {
+                    // Wait for the C tile to be computed
+                    if (!global_sync)
+                        wait_tiles_computed(tiles_computed, dma_out_i + 1);
+                    snrt_mcycle();
+                    snrt_dma_txid_t txid;
                     if (largs->partition_banks) {
-                        snrt_dma_2d_to_1d(
+                        txid = snrt_dma_2d_to_1d(
                             (void *)((uintptr_t)largs->c +
                                      dma_out_m_abs * tile_c_size),
-                            lc[buff_idx], tile_c_size,
+                            lc[c_out.buf], tile_c_size,
                             banks_per_buffer * SNRT_TCDM_BANK_WIDTH,
                             SNRT_TCDM_HYPERBANK_WIDTH);
                     } else {
-                        snrt_dma_store_2d_tile(largs->c, lc[buff_idx],
-                                               dma_out_m_abs, dma_out_n, tile_m,
-                                               tile_n, largs->ldc, largs->prec);
+                        txid = store_tile(largs->c, lc[c_out.buf],
+                                          dma_out_m_abs * tile_m,
+                                          dma_out_n_abs * tile_n, dma_out_tm,
+                                          dma_out_tn, largs->ldc, largs->prec);
                     }
-                    snrt_dma_wait_all();
+                    c_store_txid[c_out.buf] = txid;
+                    c_store_pending[c_out.buf] = 1;
+                    last_c_store_txid = txid;
+                    snrt_mcycle();
                 }
-                snrt_mcycle();
             }
         }
 
@@ -292,129 +736,200 @@ static inline int gemm_picobello(const gemm_args_t *args) {
             if (dma_in_i < num_tiles) {
                 snrt_mcycle();
                 // Switch buffers
-                // A and B buffers are switched every iteration, while the C
-                // buffer only needs to be switched after fully accumulating
-                // the result, i.e. after finishing the K loop.
-                int buff_idx = largs->double_buffer ? dma_in_i % 2 : 0;
-                int c_buff_idx = largs->double_buffer ? dma_in_mn % 2 : 0;
-                int load_a = largs->double_buffer ? (dma_in_i < 2) : (dma_in_i < 1);
+                // Every operand takes a new buffer only when its tile
+                // changes from the previous iteration, otherwise the tile
+                // is already resident in TCDM and is not loaded again.
+                int new_a = tile_ring_advance(
+                    &a_in, dma_in_m_abs * largs->k_tiles + dma_in_k_abs,
+                    num_buffers);
+                int new_b = tile_ring_advance(
+                    &b_in, dma_in_k_abs * largs->n_tiles + dma_in_n_abs,
+                    num_buffers);
+                int new_c = tile_ring_advance(
+                    &c_in, dma_in_m_abs * largs->n_tiles + dma_in_n_abs,
+                    num_buffers);
+
+                // Wait for the compute cores to release the buffers
+                if (!global_sync) {
+                    int last_use = -1;
+                    if (new_a) last_use = a_last_use[a_in.buf];
+                    if (new_b && b_last_use[b_in.buf] > last_use)
+                        last_use = b_last_use[b_in.buf];
+                    if (new_c && c_last_use[c_in.buf] > last_use)
+                        last_use = c_last_use[c_in.buf];
+                    if (last_use >= 0)
+                        wait_tiles_computed(tiles_computed, last_use + 1);
+                }
+                a_last_use[a_in.buf] = dma_in_i;
+                b_last_use[b_in.buf] = dma_in_i;
+                c_last_use[c_in.buf] = dma_in_i;
+
+                // Transfer ID of the last load issued for this tile. Transfers
+                // complete in order, so waiting for it waits for all loads.
+                snrt_dma_txid_t txid;
+                uint32_t num_loads = 0;
+
+                // The C buffer can only be reused once the store of the
+                // previous tile it contained has completed
+                if (new_c && c_store_pending[c_in.buf]) {
+                    snrt_dma_wait(c_store_txid[c_in.buf]);
+                    c_store_pending[c_in.buf] = 0;
+                }
 
                 // Load A
-                // TODO (lleone): When tiling on M and parallelizing on M there is no need
-                // to load At multiple times.
-                // If you have DOBU, you load twice and then At is available
-                // in both buffers. This can be done only when Mt is fully parallelizable
-                // in you system.
-                if (largs->load_a) {
+                if (largs->load_a && fetch_a && new_a) {
                     if (largs->partition_banks) {
-                        snrt_dma_1d_to_2d(
-                            la[buff_idx],
+                        txid = snrt_dma_1d_to_2d(
+                            la[a_in.buf],
                             (void *)((uintptr_t)largs->a +
                                      dma_in_m_abs * tile_a_size),
                             tile_a_size,
                             banks_per_buffer * SNRT_TCDM_BANK_WIDTH,
                             SNRT_TCDM_HYPERBANK_WIDTH);
                     } else {
-                        if (load_a) {
-                            snrt_dma_load_2d_tile(
-                                la[buff_idx], largs->a, dma_in_m_abs, dma_in_k_abs,
-                                tile_m, tile_k, largs->lda, largs->prec);
-                        }
+                        txid = load_tile(la[a_in.buf], largs->a,
+                                         dma_in_m_abs * tile_m,
+                                         dma_in_k_abs * tile_k, dma_in_tm,
+                                         dma_in_tk, largs->lda, largs->prec);
+                    }
+                    // Forward A to the clusters sharing it
+                    if (mcast_a) {
+                        snrt_dma_wait(txid);
+                        txid = mcast_tile(la[a_in.buf],
+                                          dma_in_tm * dma_in_tk * largs->prec,
+                                          a_neighbour, a_mask);
                     }
+                    num_loads++;
                 }
 
                 // Load B
-                if (largs->load_b) {
+                if (largs->load_b && fetch_b && new_b) {
                     if (largs->transb) {
-                        snrt_dma_load_2d_tile(lb[buff_idx], largs->b, dma_in_n,
-                                              dma_in_k_abs, tile_n, tile_k,
-                                              largs->ldb, largs->prec);
+                        txid = load_tile(lb[b_in.buf], largs->b,
+                                         dma_in_n_abs * tile_n,
+                                         dma_in_k_abs * tile_k, dma_in_tn,
+                                         dma_in_tk, largs->ldb, largs->prec);
                     } else {
                         if (largs->partition_banks) {
-                            snrt_dma_1d_to_2d(
-                                lb[buff_idx],
+                            txid = snrt_dma_1d_to_2d(
+                                lb[b_in.buf],
                                 (void *)((uintptr_t)largs->b +
                                          dma_in_k_abs * tile_b_size),
                                 tile_b_size,
                                 banks_per_buffer * SNRT_TCDM_BANK_WIDTH,
                                 SNRT_TCDM_HYPERBANK_WIDTH);
                         } else {
-                            // TODO (lleone): Is it really necessary?
-                            if (largs->parallelize_k) {
-                                snrt_dma_load_2d_tile(
-                                    lb[buff_idx], largs->b, dma_in_k_abs, dma_in_n,
-                                    tile_k, tile_n, largs->ldb, largs->prec);
-                            } else {
-                                // Multicast B to all clusters
-                                #ifdef HW_MCAST
-                                    if (snrt_cluster_idx() == 0) {
-                                        // Load B from L2
-                                        snrt_dma_load_2d_tile_mcast(
-                                        lb[buff_idx], largs->b, dma_in_k_abs, dma_in_n,
-                                        tile_k, tile_n, largs->ldb, largs->prec, 0x003C0000);
-                                    }
-                                #else
-                                    snrt_dma_load_2d_tile(
-                                    lb[buff_idx], largs->b, dma_in_k_abs, dma_in_n,
-                                    tile_k, tile_n, largs->ldb, largs->prec);
-                                #endif
-                            }
+                            txid = load_tile(lb[b_in.buf], largs->b,
+                                             dma_in_k_abs * tile_k,
+                                             dma_in_n_abs * tile_n, dma_in_tk,
+                                             dma_in_tn, largs->ldb, largs->prec);
                         }
                     }
+                    // Forward B to the clusters sharing it
+                    if (mcast_b) {
+                        snrt_dma_wait(txid);
+                        txid = mcast_tile(lb[b_in.buf],
+                                          dma_in_tk * dma_in_tn * largs->prec,
+                                          b_neighbour, b_mask);
+                    }
+                    num_loads++;
                 }
 
                 // Load C
-                // C tile is loaded only upon the first k iteration, then
+                // C tile is loaded only when it enters its buffer, then
                 // the C array will contain the partial results from the
-                // previous iteration
-                if (largs->load_c && dma_in_k_beta != 0) {
+                // previous iterations
+                if (largs->load_c && new_c && dma_in_k_beta != 0) {
                     if (dma_in_k_abs == 0) {
                         if (largs->partition_banks) {
-                            snrt_dma_1d_to_2d(
-                                lc[c_buff_idx],
+                            txid = snrt_dma_1d_to_2d(
+                                lc[c_in.buf],
                                 (void *)((uintptr_t)largs->c +
                                          dma_in_m_abs * tile_c_size),
                                 tile_c_size,
                                 banks_per_buffer * SNRT_TCDM_BANK_WIDTH,
                                 SNRT_TCDM_HYPERBANK_WIDTH);
                         } else {
-                            snrt_dma_load_2d_tile(lc[c_buff_idx], largs->c,
-                                                  dma_in_m_abs, dma_in_n,
-                                                  tile_m, tile_n, largs->ldc,
-                                                  largs->prec);
+                            txid = load_tile(lc[c_in.buf], largs->c,
+                                             dma_in_m_abs * tile_m,
+                                             dma_in_n_abs * tile_n, dma_in_tm,
+                                             dma_in_tn, largs->ldc, largs->prec);
                         }
+                        num_loads++;
                     } else if (dma_in_k == 0) {
                         // Clusters other than the first need to initialize
                         // the C array to zero in their first iteration
                         if (largs->partition_banks) {
-                            snrt_dma_1d_to_2d(
-                                lc[c_buff_idx], snrt_cluster()->zeromem.mem,
+                            txid = snrt_dma_1d_to_2d(
+                                lc[c_in.buf], snrt_cluster()->zeromem.mem,
                                 tile_c_size,
                                 banks_per_buffer * SNRT_TCDM_BANK_WIDTH,
                                 SNRT_TCDM_HYPERBANK_WIDTH);
                         } else {
-                            snrt_dma_start_1d(lc[c_buff_idx],
-                                              snrt_cluster()->zeromem.mem,
-                                              tile_c_size);
+                            txid = snrt_dma_start_1d(
+                                lc[c_in.buf], snrt_cluster()->zeromem.mem,
+                                dma_in_tm * dma_in_tn * largs->prec);
                         }
+                        num_loads++;
+                    } else {
+                        // In n-k-m order, C was evicted after the previous k
+                        // iteration and its partial result is reloaded, once
+                        // its store has completed
+                        snrt_dma_wait(last_c_store_txid);
+                        txid = load_tile(lc[c_in.buf], largs->c,
+                                         dma_in_m_abs * tile_m,
+                                         dma_in_n_abs * tile_n, dma_in_tm,
+                                         dma_in_tn, largs->ldc, largs->prec);
+                        num_loads++;
                     }
                 }
-                snrt_dma_wait_all();
+                if (num_loads) snrt_dma_wait(txid);
                 snrt_mcycle();
+
+                // Signal the tile is ready
+                if (!global_sync) *tiles_loaded = dma_in_i + 1;
             }
         }
 
         // Additional barrier required when not double buffering
-        if (!largs->double_buffer) snrt_global_barrier(comm);
+        if (num_buffers == 1 && global_sync) pb_global_barrier(comm);
 
         // Compute phase
         if (comp_i >= 0 && comp_i < num_tiles) {
             // Switch buffers
-            int buff_idx = largs->double_buffer ? comp_i % 2 : 0;
-            int c_buff_idx = largs->double_buffer ? comp_mn % 2 : 0;
+            tile_ring_advance(&a_comp, comp_m_abs * largs->k_tiles + comp_k_abs,
+                              num_buffers);
+            tile_ring_advance(&b_comp, comp_k_abs * largs->n_tiles + comp_n_abs,
+                              num_buffers);
+            tile_ring_advance(&c_comp, comp_m_abs * largs->n_tiles + comp_n_abs,
+                              num_buffers);
+
+            // With RedMulE, the first compute core dispatches the whole tile
+            // and the other compute cores are free
+            if (use_redmule && snrt_cluster_core_idx() == 0) {
+                // Wait for the tile to be loaded
+                if (!global_sync)
+                    while (*tiles_loaded < comp_i + 1)
+                        ;
+
+                redmule_tile(la[a_comp.buf], lb[b_comp.buf], lc[c_comp.buf],
+                             comp_tm, comp_tn, comp_tk, comp_k_beta,
+                             largs->prec);
+
+                // Signal the tile is computed on behalf of all compute cores
+                if (!global_sync)
+                    __atomic_add_fetch(tiles_computed,
+                                       snrt_cluster_compute_core_num(),
+                                       __ATOMIC_RELAXED);
+            }
 
             // Only compute cores participate in the tile computation
-            if (!snrt_is_dm_core()) {
+            if (!snrt_is_dm_core() && !use_redmule) {
+                // Wait for the tile to be loaded
+                if (!global_sync)
+                    while (*tiles_loaded < comp_i + 1)
+                        ;
+
                 // uint32_t start_cycle = snrt_mcycle();
 
                 // Tile computation
@@ -424,65 +939,72 @@ static inline int gemm_picobello(const gemm_args_t *args) {
                 sc_st_args.partition_banks = largs->partition_banks;
                 sc_st_args.transa = largs->transa;
                 sc_st_args.transb = largs->transb;
-                sc_st_args.a = la[buff_idx];
+                sc_st_args.a = la[a_comp.buf];
                 if (largs->transa) {
-                    sc_st_args.lda = tile_m;
+                    sc_st_args.lda = comp_tm;
                 } else if (largs->partition_banks) {
                     sc_st_args.lda = calculate_partitioned_banks_stride(
                         banks_per_buffer, tile_k, largs->prec);
                 } else {
-                    sc_st_args.lda = tile_k;
+                    sc_st_args.lda = comp_tk;
                 }
-                sc_st_args.b = lb[buff_idx];
+                sc_st_args.b = lb[b_comp.buf];
                 if (largs->transb) {
-                    sc_st_args.ldb = tile_k;
+                    sc_st_args.ldb = comp_tk;
                 } else if (largs->partition_banks) {
                     sc_st_args.ldb = calculate_partitioned_banks_stride(
                         banks_per_buffer, tile_n, largs->prec);
                 } else {
-                    sc_st_args.ldb = tile_n;
+                    sc_st_args.ldb = comp_tn;
                 }
                 sc_st_args.beta = comp_k_beta;
-                sc_st_args.c = lc[c_buff_idx];
+                sc_st_args.c = lc[c_comp.buf];
                 if (largs->partition_banks) {
                     sc_st_args.ldc = calculate_partitioned_banks_stride(
                         banks_per_buffer, tile_n, largs->prec);
                 } else {
-                    sc_st_args.ldc = tile_n;
+                    sc_st_args.ldc = comp_tn;
                 }
-                sc_st_args.m = tile_m;
-                sc_st_args.n = tile_n;
-                sc_st_args.k = tile_k;
+                sc_st_args.m = comp_tm;
+                sc_st_args.n = comp_tn;
+                sc_st_args.k = comp_tk;
                 sc_st_gemm(largs->gemm_fp, &sc_st_args);
 
                 // uint32_t end_cycle = snrt_mcycle();
+
+                // Signal the tile is computed, once all results are in TCDM
+                if (!global_sync) {
+                    snrt_fpu_fence();
+                    __atomic_add_fetch(tiles_computed, 1, __ATOMIC_RELAXED);
+                }
             }
 
-            // Add the partial result tiles from the various clusters together
-            // in a logarithmic reduction fashion.
+            // Add the partial result tiles from the various clusters together,
+            // reducing along the mesh rows and columns.
             // Note: both compute and DMA cores participate in this step.
             if (largs->parallelize_k && (comp_k == (cluster_k_tiles - 1))) {
-                snrt_global_reduction_dma(
-                    (double *)lcr, (double *)lc[c_buff_idx], tile_m * tile_n);
+                mesh_reduction(&red, lc[c_comp.buf], comp_tm * comp_tn,
+                               largs->prec, comm);
             }
         }
 
         // Synchronize cores after every iteration
-        snrt_global_barrier(comm);
+        if (global_sync) pb_global_barrier(comm);
     }
 
-    // Before completing the kernel, each cluster writes back its C tiles in the
-    // original memory tile. This is necessary only to run teh verify.py script
-
-    if (snrt_is_dm_core() && snrt_cluster_idx() < num_working_clusters) {
-        write_back_c_tiles(largs, tile_m, tile_n);
+    if (use_redmule && snrt_cluster_core_idx() == 0) {
+        snrt_interrupt_disable(IRQ_M_ACC);
+        redmule_cg_disable();
     }
 
+    // Wait for the last C stores
+    if (snrt_is_dm_core()) snrt_dma_wait_all();
+
     return 0;
 }
 
 
 int main () {
-    gemm_picobello(&args);
+    gemm_picobello(&args, &pb_args);
     return 0;
 }
@@ -0,0 +1,46 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Picobello-specific GEMM job arguments, complementing the Snitch
+ *        `gemm_args_t`. Emitted by `scripts/datagen.py`.
+ */
+typedef struct {
+    // Parallelize the N dimension across clusters. When combined with
+    // `parallelize_m`, the cluster mesh is mapped onto a 2D block
+    // decomposition of C: mesh rows split M and mesh columns split N.
+    uint32_t parallelize_n;
+    // Fetch the A and B tiles shared by multiple clusters only once from L2,
+    // and multicast them over the NoC to the other clusters. In 2D mode, A
+    // is multicast along mesh rows and B down mesh columns.
+    uint32_t mcast;
+    // Number of buffers per operand, i.e. depth of the DMA-in, compute and
+    // DMA-out pipeline. If zero, it is derived from `double_buffer`.
+    uint32_t num_buffers;
+    // Loop order over the tiles of a cluster: 0 selects the order moving the
+    // fewest bytes, 1 forces k-n-m (K innermost) and 2 forces n-k-m
+    // (N innermost) where supported.
+    uint32_t loop_order;
+    // Compute the tiles on the cluster's RedMulE instead of the cores, with
+    // `gemm_fp` unused. Only FP16 and FP8 GEMMs with non-transposed,
+    // contiguous tiles, alpha = 1 and beta in {0, 1} are supported.
+    uint32_t use_redmule;
+} pb_gemm_args_t;
+
+/**
+ * @brief Rows of A and C used by a cluster, placed by the linker in the
+ *        memory tile closest to the cluster. Emitted by `scripts/datagen.py`.
+ */
+typedef struct {
+    // First element of the A rows
+    void *a;
+    // First element of the C rows
+    void *c;
+    // Index of the first row held by the slabs
+    uint32_t row;
+} pb_l2_slab_t;
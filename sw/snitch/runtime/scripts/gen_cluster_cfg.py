@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generate the cluster configuration header of the Snitch runtime
+# (`pb_cluster_cfg.h`) from the Snitch cluster configuration.
+#
+# It exposes the parameters of the cluster which are not part of the
+# picobello address map, such as the cluster alias region: the address range
+# under which every cluster sees its own TCDM, peripherals and zero memory,
+# independently of its position in the mesh.
+
+import argparse
+import sys
+from pathlib import Path
+
+import json5
+
+
+def emit_header(cfg, cfg_name):
+    cluster = cfg['cluster']
+    alias_enable = int(cluster.get('alias_region_enable', False))
+    alias_base = cluster.get('alias_region_base', 0)
+    return f"""\
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Generated by gen_cluster_cfg.py from {cfg_name}. Do not edit.
+
+#pragma once
+
+// Cluster alias region, mapping to the local cluster in every cluster
+#define PB_CLUSTER_ALIAS_ENABLE {alias_enable}
+#define PB_CLUSTER_ALIAS_BASE_ADDR {alias_base:#x}
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate pb_cluster_cfg.h')
+    parser.add_argument('-c', '--cfg', type=Path, required=True,
+                        help='Snitch cluster configuration file')
+    parser.add_argument('-o', '--output', type=Path, required=True,
+                        help='Output header')
+    args = parser.parse_args()
+    with open(args.cfg) as f:
+        cfg = json5.load(f)
+    header = emit_header(cfg, args.cfg.name)
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text(header)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generate the NoC topology header of the Snitch runtime (`pb_noc_cfg.h`)
+# from the FlooNoC configuration.
+#
+# Router arrays are laid out side by side along X, in the order of their
+# `xy_id_offset`, and the clusters and memory tiles are placed at the
+# coordinates of the routers they are connected to. Coordinates are thus
+# physical mesh coordinates, such that the number of hops between two routers
+# under XY routing is their Manhattan distance.
+
+import argparse
+import sys
+from pathlib import Path
+
+import yaml
+
+CLUSTER_EP = 'cluster'
+MEM_TILE_EP = 'l2_spm'
+
+
+def as_list(value):
+    return value if isinstance(value, list) else [value]
+
+
+def flat_idx(idx, shape):
+    """Row-major index of a (possibly multi-dimensional) array element."""
+    flat = 0
+    for i, size in zip(as_list(idx), as_list(shape)):
+        flat = flat * size + i
+    return flat
+
+
+def array_indices(rng):
+    """All indices in an inclusive range per dimension, in row-major order."""
+    indices = [[]]
+    for lo, hi in rng:
+        indices = [idx + [i] for idx in indices for i in range(lo, hi + 1)]
+    return indices
+
+
+class PbNoc:
+    """Physical layout of the picobello NoC."""
+
+    def __init__(self, cfg):
+        with open(cfg) as f:
+            self.cfg = yaml.safe_load(f)
+
+        # Place router arrays side by side along X
+        self.router_x = {}
+        x = 0
+        routers = sorted(self.cfg['routers'],
+                         key=lambda r: r.get('xy_id_offset', {}).get('x', 0))
+        for router in routers:
+            self.router_x[router['name']] = x
+            x += as_list(router['array'])[0]
+        self.mesh_x = x
+        self.mesh_y = max(as_list(r['array'])[1] for r in routers)
+
+        self.endpoints = {ep['name']: ep for ep in self.cfg['endpoints']}
+        self.clusters = self.endpoint_coords(CLUSTER_EP)
+        self.mem_tiles = self.endpoint_coords(MEM_TILE_EP)
+
+        # Clusters must form a rectangle, with cluster index x * Y + y
+        shape = self.endpoints[CLUSTER_EP]['array']
+        self.cluster_per_row, self.cluster_per_col = shape
+        self.cluster_x_offset, self.cluster_y_offset = self.clusters[0]
+        for i, (cx, cy) in enumerate(self.clusters):
+            col, row = divmod(i, self.cluster_per_col)
+            if (cx, cy) != (self.cluster_x_offset + col, self.cluster_y_offset + row):
+                raise ValueError('Clusters must be connected to a rectangle of routers')
+
+    def endpoint_coords(self, name):
+        """Mesh coordinates of the routers every endpoint of an array is connected to."""
+        shape = self.endpoints[name].get('array', [1])
+        num = 1
+        for size in as_list(shape):
+            num *= size
+        coords = [None] * num
+        for conn in self.cfg['connections']:
+            if conn['src'] != name:
+                continue
+            if 'dst_idx' in conn:
+                src = [conn.get('src_idx', [0])]
+                dst = [conn['dst_idx']]
+            else:
+                src = array_indices([r if isinstance(r, list) else [r, r]
+                                     for r in conn['src_range']])
+                dst = array_indices(conn['dst_range'])
+            for s, (dx, dy) in zip(src, dst):
+                coords[flat_idx(s, shape)] = (self.router_x[conn['dst']] + dx, dy)
+        if None in coords:
+            raise ValueError(f'Not all `{name}` endpoints are connected to a router')
+        return coords
+
+    @staticmethod
+    def hops(a, b):
+        return abs(a[0] - b[0]) + abs(a[1] - b[1])
+
+    def closest_mem_tile(self, cidx):
+        """Memory tile with the fewest hops to a cluster, the lowest index on ties."""
+        return min(range(len(self.mem_tiles)),
+                   key=lambda t: self.hops(self.clusters[cidx], self.mem_tiles[t]))
+
+    def emit_header(self, cfg_name):
+        tiles = range(len(self.mem_tiles))
+        closest = [self.closest_mem_tile(c) for c in range(len(self.clusters))]
+        return f"""\
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Generated by gen_noc_cfg.py from {cfg_name}. Do not edit.
+
+#pragma once
+
+// Size of the NoC mesh, in routers
+#define PB_MESH_X {self.mesh_x}
+#define PB_MESH_Y {self.mesh_y}
+
+// Clusters form a PB_CLUSTER_PER_ROW x PB_CLUSTER_PER_COL rectangle of the
+// mesh, whose bottom-left cluster (cluster 0) is at the given coordinates
+#define PB_CLUSTER_PER_ROW {self.cluster_per_row}
+#define PB_CLUSTER_PER_COL {self.cluster_per_col}
+#define PB_CLUSTER_X_OFFSET {self.cluster_x_offset}
+#define PB_CLUSTER_Y_OFFSET {self.cluster_y_offset}
+
+// Mesh coordinates of the memory tiles
+#define PB_NUM_MEM_TILES {len(self.mem_tiles)}
+#define PB_MEM_TILE_X {{{', '.join(str(self.mem_tiles[t][0]) for t in tiles)}}}
+#define PB_MEM_TILE_Y {{{', '.join(str(self.mem_tiles[t][1]) for t in tiles)}}}
+
+// Memory tile with the fewest hops to every cluster
+#define PB_CLOSEST_MEM_TILE {{{', '.join(str(t) for t in closest)}}}
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate pb_noc_cfg.h')
+    parser.add_argument('-c', '--cfg', type=Path, required=True,
+                        help='FlooNoC configuration file')
+    parser.add_argument('-o', '--output', type=Path, required=True,
+                        help='Output header')
+    args = parser.parse_args()
+    header = PbNoc(args.cfg).emit_header(args.cfg.name)
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text(header)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
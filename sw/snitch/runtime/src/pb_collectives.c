@@ -0,0 +1,33 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+extern inline uint32_t pb_comm_ring(pb_comm_t comm, uint8_t *ring);
+
+extern inline uint32_t pb_comm_rank(pb_comm_t comm);
+
+extern inline void pb_collective_slice(uint32_t len, uint32_t num_ranks,
+                                       uint32_t rank, uint32_t *offset,
+                                       uint32_t *slice_len);
+
+extern inline void pb_collective_add(void *dst, const void *src, uint32_t len,
+                                     uint32_t prec);
+
+extern inline void pb_collective_mcast(void *ptr, size_t size, pb_comm_t comm);
+
+extern inline void pb_reduce_scatter_ring(void *buf, void *tmp, uint32_t len,
+                                          uint32_t prec, pb_comm_t comm);
+
+extern inline void pb_allgather_slices(void *buf, uint32_t len, uint32_t size,
+                                       pb_comm_t comm);
+
+extern inline void pb_broadcast(void *buf, size_t size, uint32_t root,
+                                pb_comm_t comm);
+
+extern inline void pb_allgather(void *buf, size_t size, pb_comm_t comm);
+
+extern inline void pb_reduce_scatter(void *buf, void *tmp, uint32_t len,
+                                     uint32_t prec, pb_comm_t comm);
+
+extern inline void pb_allreduce(void *buf, void *tmp, uint32_t len,
+                                uint32_t prec, pb_comm_t comm);
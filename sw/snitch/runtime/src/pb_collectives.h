@@ -0,0 +1,244 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief This file contains collective operations between the clusters of a
+ * Picobello communicator, on buffers in their TCDM.
+ *
+ * Buffers must be allocated at the same TCDM offset in all members of the
+ * communicator, and the collectives must be called by all cores of all
+ * members. Clusters outside of the communicator return immediately.
+ *
+ * Data which is sent to several members is multicast, while reductions
+ * follow a ring over the members. The ring visits the mesh columns in a
+ * snake order, so that consecutive members of a rectangular communicator
+ * are mesh neighbours and every transfer of the ring crosses a single link,
+ * except for the one closing the ring. The rank of a member is its position
+ * on the ring.
+ */
+
+/**
+ * @brief Get the ring of a communicator
+ * @param comm The communicator
+ * @param ring Array of at least `comm->size` entries, filled with the
+ *             indices of the members in ring order
+ * @return The rank of the local cluster
+ */
+inline uint32_t pb_comm_ring(pb_comm_t comm, uint8_t *ring) {
+    uint32_t rank = 0, n = 0;
+    for (uint32_t col = 0; col < PB_CLUSTER_PER_ROW; col++) {
+        for (uint32_t i = 0; i < PB_CLUSTER_PER_COL; i++) {
+            uint32_t row = (col % 2) ? PB_CLUSTER_PER_COL - 1 - i : i;
+            uint32_t cidx = col * PB_CLUSTER_PER_COL + row;
+            if (!((comm->members >> cidx) & 1)) continue;
+            if (cidx == snrt_cluster_idx()) rank = n;
+            ring[n++] = cidx;
+        }
+    }
+    return rank;
+}
+
+/**
+ * @brief Get the rank of the local cluster in a communicator
+ */
+inline uint32_t pb_comm_rank(pb_comm_t comm) {
+    uint8_t ring[PB_COMM_MAX_CLUSTERS];
+    return pb_comm_ring(comm, ring);
+}
+
+/**
+ * @brief Get the slice of a buffer owned by a rank
+ * @param len The number of elements in the buffer
+ * @param num_ranks The number of ranks
+ * @param rank The rank
+ * @param offset Index of the first element of the slice
+ * @param slice_len Number of elements in the slice
+ */
+inline void pb_collective_slice(uint32_t len, uint32_t num_ranks,
+                                uint32_t rank, uint32_t *offset,
+                                uint32_t *slice_len) {
+    *offset = rank * len / num_ranks;
+    *slice_len = (rank + 1) * len / num_ranks - *offset;
+}
+
+/**
+ * @brief Accumulate `src` into `dst`, splitting the work among the compute
+ *        cores
+ */
+inline void pb_collective_add(void *dst, const void *src, uint32_t len,
+                              uint32_t prec) {
+    uint32_t core_idx = snrt_cluster_core_idx();
+    uint32_t num_cores = snrt_cluster_compute_core_num();
+    if (prec == sizeof(double)) {
+        for (uint32_t i = core_idx; i < len; i += num_cores)
+            ((double *)dst)[i] += ((const double *)src)[i];
+    } else if (prec == sizeof(float)) {
+        for (uint32_t i = core_idx; i < len; i += num_cores)
+            ((float *)dst)[i] += ((const float *)src)[i];
+    } else {
+        for (uint32_t i = core_idx; i < len; i += num_cores)
+            ((__fp16 *)dst)[i] += ((const __fp16 *)src)[i];
+    }
+}
+
+/**
+ * @brief Copy a local buffer to the same location in all other members of a
+ *        communicator, with the fewest multicast transactions
+ * @note Must only be called by the DM core. Does not wait for the transfers
+ *       to complete.
+ */
+inline void pb_collective_mcast(void *ptr, size_t size, pb_comm_t comm) {
+    pb_mcast_t mcasts[PB_COMM_MAX_CLUSTERS];
+    uint32_t others = comm->members & ~(1u << snrt_cluster_idx());
+    uint32_t num_mcasts = pb_mcast_decompose(others, mcasts);
+    for (uint32_t i = 0; i < num_mcasts; i++) {
+        snrt_dma_start_1d_mcast(pb_mcast_addr(ptr, mcasts[i]), ptr, size,
+                                mcasts[i].mask);
+    }
+}
+
+/**
+ * @brief Ring reduce-scatter, without synchronizing the members on return
+ * @note After `comm->size - 1` steps, every member holds the result for its
+ *       own slice. At every step, a member sends one partially reduced slice
+ *       to its successor, and accumulates the slice received from its
+ *       predecessor. Slices are received in distinct locations of `tmp`, so
+ *       that the ring never stalls on a slower member.
+ */
+inline void pb_reduce_scatter_ring(void *buf, void *tmp, uint32_t len,
+                                   uint32_t prec, pb_comm_t comm) {
+    uint8_t ring[PB_COMM_MAX_CLUSTERS];
+    uint32_t num_ranks = comm->size;
+    uint32_t rank = pb_comm_ring(comm, ring);
+    uint32_t next = ring[(rank + 1) % num_ranks];
+    uint32_t rx_count = comm->rx_count;
+
+    // The buffer must be complete before it is sent
+    snrt_cluster_hw_barrier();
+
+    for (uint32_t s = 0; s + 1 < num_ranks; s++) {
+        uint32_t offset, slice_len;
+        if (snrt_is_dm_core()) {
+            uint32_t tx_rank = (rank + 2 * num_ranks - s - 1) % num_ranks;
+            pb_collective_slice(len, num_ranks, tx_rank, &offset, &slice_len);
+            if (slice_len) {
+                snrt_dma_start_1d(
+                    snrt_remote_l1_ptr((char *)tmp + offset * prec,
+                                       snrt_cluster_idx(), next),
+                    (char *)buf + offset * prec, slice_len * prec);
+                snrt_dma_wait_all();
+            }
+            pb_comm_arrive(&comm->rx_flag, next);
+        } else {
+            uint32_t rx_rank = (rank + 2 * num_ranks - s - 2) % num_ranks;
+            pb_collective_slice(len, num_ranks, rx_rank, &offset, &slice_len);
+            while (comm->rx_flag < rx_count + s + 1)
+                ;
+            pb_collective_add((char *)buf + offset * prec,
+                              (char *)tmp + offset * prec, slice_len, prec);
+        }
+        // The accumulated slice must be complete before forwarding it
+        snrt_cluster_hw_barrier();
+    }
+
+    if (snrt_is_dm_core()) comm->rx_count = rx_count + num_ranks - 1;
+}
+
+/**
+ * @brief Multicast the slice of the local cluster to all other members, and
+ *        synchronize the members
+ */
+inline void pb_allgather_slices(void *buf, uint32_t len, uint32_t size,
+                                pb_comm_t comm) {
+    if (snrt_is_dm_core()) {
+        uint32_t offset, slice_len;
+        pb_collective_slice(len, comm->size, pb_comm_rank(comm), &offset,
+                            &slice_len);
+        if (slice_len) {
+            pb_collective_mcast((char *)buf + offset * size, slice_len * size,
+                                comm);
+            snrt_dma_wait_all();
+        }
+    }
+    pb_global_barrier(comm);
+}
+
+/**
+ * @brief Broadcast a buffer from one member to all other members
+ * @param buf The buffer
+ * @param size The size of the buffer, in bytes
+ * @param root Index of the cluster holding the data
+ * @param comm The communicator
+ */
+inline void pb_broadcast(void *buf, size_t size, uint32_t root,
+                         pb_comm_t comm) {
+    if (!comm->is_participant) return;
+
+    // The buffer must not be in use by any member when it is overwritten
+    pb_global_barrier(comm);
+    if (snrt_is_dm_core() && snrt_cluster_idx() == root) {
+        pb_collective_mcast(buf, size, comm);
+        snrt_dma_wait_all();
+    }
+    pb_global_barrier(comm);
+}
+
+/**
+ * @brief Gather a slice from every member in all members
+ * @param buf Buffer of `comm->size` slices, where the slice of the member of
+ *            rank r is at offset r * size
+ * @param size The size of a slice, in bytes
+ * @param comm The communicator
+ */
+inline void pb_allgather(void *buf, size_t size, pb_comm_t comm) {
+    if (!comm->is_participant) return;
+
+    // The buffer must not be in use by any member when it is overwritten
+    pb_global_barrier(comm);
+    pb_allgather_slices(buf, comm->size * size, 1, comm);
+}
+
+/**
+ * @brief Reduce the buffers of all members, leaving every member with one
+ *        slice of the result
+ * @param buf Buffer of `len` elements. On return, the slice of the local
+ *            cluster (see pb_collective_slice()) holds the element-wise sum
+ *            over all members, and the rest of the buffer is undefined.
+ * @param tmp Scratch buffer of `len` elements
+ * @param len The number of elements
+ * @param prec The size of the elements in bytes: 8 (FP64), 4 (FP32) or
+ *             2 (FP16)
+ * @param comm The communicator
+ */
+inline void pb_reduce_scatter(void *buf, void *tmp, uint32_t len,
+                              uint32_t prec, pb_comm_t comm) {
+    if (!comm->is_participant) return;
+
+    pb_reduce_scatter_ring(buf, tmp, len, prec, comm);
+    // Scratch buffers may be reused once all members are done
+    pb_global_barrier(comm);
+}
+
+/**
+ * @brief Reduce the buffers of all members, leaving every member with the
+ *        whole result
+ * @param buf Buffer of `len` elements, holding the element-wise sum over all
+ *            members on return
+ * @param tmp Scratch buffer of `len` elements
+ * @param len The number of elements
+ * @param prec The size of the elements in bytes: 8 (FP64), 4 (FP32) or
+ *             2 (FP16)
+ * @param comm The communicator
+ * @note Implemented as a ring reduce-scatter followed by a multicast
+ *       allgather. A slice is only multicast once it has been fully reduced,
+ *       which implies that all members are done with it.
+ */
+inline void pb_allreduce(void *buf, void *tmp, uint32_t len, uint32_t prec,
+                         pb_comm_t comm) {
+    if (!comm->is_participant) return;
+
+    pb_reduce_scatter_ring(buf, tmp, len, prec, comm);
+    pb_allgather_slices(buf, len, prec, comm);
+}
@@ -0,0 +1,26 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+volatile uint32_t pb_l2_heap_used[PB_NUM_MEM_TILES];
+
+volatile uint32_t pb_l2_window_used;
+
+extern inline void pb_l2_heap_bounds(uint32_t tile_idx, uintptr_t *start,
+                                     uintptr_t *end);
+
+extern inline void *pb_l2_alloc_tile(uint32_t tile_idx, size_t size);
+
+extern inline void *pb_l2_alloc_near(size_t size, uint32_t cidx);
+
+extern inline void *pb_l2_alloc_near(size_t size);
+
+extern inline uint32_t pb_l2_alloc_interleaved(size_t size, size_t chunk_size,
+                                               pb_l2_interleaved_t *buf);
+
+extern inline void *pb_l2_interleaved_ptr(const pb_l2_interleaved_t *buf,
+                                          size_t offset);
+
+extern inline void *pb_l2_alloc_window(size_t size);
+
+extern inline void *pb_l2_window_tile_ptr(void *ptr);
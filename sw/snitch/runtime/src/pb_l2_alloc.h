@@ -0,0 +1,222 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief This file contains functions to allocate buffers in the L2 memory
+ * tiles.
+ *
+ * Every memory tile holds a heap, from the end of the sections the linker
+ * placed in it (see `memory.ld`) to the end of the tile. The first memory
+ * tile holds the default sections and the Snitch L3 heap, and is therefore
+ * not managed by this allocator. Heaps are shared by all clusters: an
+ * allocation atomically bumps the heap pointer of its tile, and memory is
+ * never freed.
+ *
+ * If the interleaved L2 window is enabled in hardware, the top
+ * PB_L2_INTERLEAVE_TILE_SIZE bytes of every memory tile are reserved for it,
+ * and excluded from the heaps. Consecutive blocks of the window rotate
+ * across all memory tiles, so that a buffer allocated in the window with
+ * pb_l2_alloc_window() is streamed with the bandwidth of all tiles.
+ *
+ * The linker script (`memory.ld`) keeps the default sections and the
+ * `.l2_tile_<i>` sections below the window. The L3 heap of the first memory
+ * tile is not bounded by the Snitch runtime, and must not grow beyond
+ * PB_L2_INTERLEAVE_TILE_SIZE bytes below the tile end.
+ */
+
+// Interleaved L2 window, configured in `pb_l2_cfg.h`, which is generated from
+// the same configuration as the hardware
+#define PB_L2_INTERLEAVE_SIZE (PB_NUM_MEM_TILES * PB_L2_INTERLEAVE_TILE_SIZE)
+
+// Alignment of all L2 allocations, matching the width of the wide NoC
+#define PB_L2_ALLOC_ALIGN 64
+
+#define PB_L2_ALLOC_ALIGN_UP(x) \
+    (((x) + PB_L2_ALLOC_ALIGN - 1) & ~(PB_L2_ALLOC_ALIGN - 1))
+
+extern char __l2_tile_1_end[], __l2_tile_2_end[], __l2_tile_3_end[],
+    __l2_tile_4_end[], __l2_tile_5_end[], __l2_tile_6_end[], __l2_tile_7_end[];
+
+// Number of bytes allocated from the heap of every memory tile
+extern volatile uint32_t pb_l2_heap_used[PB_NUM_MEM_TILES];
+
+// Number of bytes allocated from the interleaved L2 window
+extern volatile uint32_t pb_l2_window_used;
+
+/**
+ * @brief Buffer interleaved across memory tiles, in chunks of a fixed size
+ *
+ * Chunk i of the buffer is placed in memory tile `tiles[i % num_tiles]`.
+ */
+typedef struct {
+    // Part of the buffer in every memory tile
+    void *tiles[PB_NUM_MEM_TILES];
+    uint32_t num_tiles;
+    uint32_t chunk_size;
+} pb_l2_interleaved_t;
+
+/**
+ * @brief Get the heap bounds of a memory tile
+ * @param tile_idx The memory tile index
+ * @param start Address of the first byte of the heap
+ * @param end Address past the last byte of the heap
+ */
+inline void pb_l2_heap_bounds(uint32_t tile_idx, uintptr_t *start,
+                              uintptr_t *end) {
+    static char *const heap_start[] = {
+        NULL,            __l2_tile_1_end, __l2_tile_2_end, __l2_tile_3_end,
+        __l2_tile_4_end, __l2_tile_5_end, __l2_tile_6_end, __l2_tile_7_end};
+    // Every memory tile needs a `.l2_tile_<i>` section in `memory.ld`
+    static_assert(sizeof(heap_start) / sizeof(heap_start[0]) >=
+                      PB_NUM_MEM_TILES,
+                  "memory.ld has no section for some memory tiles");
+    *end = pb_l2_tile_address(tile_idx) + PICOBELLO_ADDRMAP_L2_SPM_0_SIZE;
+#if PB_L2_INTERLEAVE_ENABLE
+    *end -= PB_L2_INTERLEAVE_TILE_SIZE;
+#endif
+    *start = heap_start[tile_idx]
+                 ? PB_L2_ALLOC_ALIGN_UP((uintptr_t)heap_start[tile_idx])
+                 : *end;
+}
+
+/**
+ * @brief Allocate a buffer in a memory tile
+ * @param tile_idx The memory tile index
+ * @param size The size of the buffer, in bytes
+ * @return Pointer to the buffer, aligned to PB_L2_ALLOC_ALIGN, or NULL if
+ *         the tile has not enough free memory
+ */
+inline void *pb_l2_alloc_tile(uint32_t tile_idx, size_t size) {
+    uintptr_t start, end;
+    pb_l2_heap_bounds(tile_idx, &start, &end);
+    size = PB_L2_ALLOC_ALIGN_UP(size);
+    // Cheap early exit, without wasting memory, when the tile is full
+    if (start + pb_l2_heap_used[tile_idx] + size > end) return NULL;
+    uint32_t offset =
+        __atomic_fetch_add(&pb_l2_heap_used[tile_idx], size, __ATOMIC_RELAXED);
+    // Another cluster may have filled the tile in the meantime
+    if (start + offset + size > end) return NULL;
+    return (void *)(start + offset);
+}
+
+/**
+ * @brief Allocate a buffer in the memory tile closest to a cluster
+ * @param size The size of the buffer, in bytes
+ * @param cidx The cluster index
+ * @return Pointer to the buffer, or NULL if no tile has enough free memory
+ * @note Falls back to the other tiles, in order of increasing number of
+ *       hops from the cluster, when the closest tile is full
+ */
+inline void *pb_l2_alloc_near(size_t size, uint32_t cidx) {
+    uint32_t tried = 0;
+    for (uint32_t i = 0; i < PB_NUM_MEM_TILES; i++) {
+        uint32_t best = 0, best_hops = UINT32_MAX;
+        for (uint32_t t = 0; t < PB_NUM_MEM_TILES; t++) {
+            if ((tried >> t) & 1) continue;
+            uint32_t hops = pb_mem_tile_hops(cidx, t);
+            if (hops < best_hops) {
+                best = t;
+                best_hops = hops;
+            }
+        }
+        tried |= 1u << best;
+        void *ptr = pb_l2_alloc_tile(best, size);
+        if (ptr) return ptr;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Allocate a buffer in the memory tile closest to the local cluster
+ * This is a convenience overload of pb_l2_alloc_near()
+ */
+inline void *pb_l2_alloc_near(size_t size) {
+    return pb_l2_alloc_near(size, snrt_cluster_idx());
+}
+
+/**
+ * @brief Allocate a buffer interleaved across all memory tiles with a heap
+ * @param size The size of the buffer, in bytes
+ * @param chunk_size The size of the chunks, in bytes
+ * @param buf The interleaved buffer
+ * @return Zero on success, non-zero if a tile has not enough free memory
+ *         or no tile has a heap
+ * @note Spreads the bandwidth of a buffer accessed by all clusters over all
+ *       tiles, rather than concentrating it on a single tile. On failure,
+ *       the parts allocated so far are lost.
+ */
+inline uint32_t pb_l2_alloc_interleaved(size_t size, size_t chunk_size,
+                                        pb_l2_interleaved_t *buf) {
+    // Tiles with a heap
+    uint32_t heap_tiles[PB_NUM_MEM_TILES];
+    uint32_t num_tiles = 0;
+    for (uint32_t t = 0; t < PB_NUM_MEM_TILES; t++) {
+        uintptr_t start, end;
+        pb_l2_heap_bounds(t, &start, &end);
+        if (start != end) heap_tiles[num_tiles++] = t;
+    }
+    if (!num_tiles) return 1;
+
+    buf->num_tiles = num_tiles;
+    buf->chunk_size = chunk_size;
+    size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    size_t chunks_per_tile = (num_chunks + num_tiles - 1) / num_tiles;
+    for (uint32_t i = 0; i < num_tiles; i++) {
+        buf->tiles[i] =
+            pb_l2_alloc_tile(heap_tiles[i], chunks_per_tile * chunk_size);
+        if (!buf->tiles[i]) return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Get the address of a byte of an interleaved buffer
+ * @param buf The interleaved buffer
+ * @param offset The offset of the byte in the buffer
+ */
+inline void *pb_l2_interleaved_ptr(const pb_l2_interleaved_t *buf,
+                                   size_t offset) {
+    size_t chunk = offset / buf->chunk_size;
+    size_t tile_offset = (chunk / buf->num_tiles) * buf->chunk_size +
+                         offset % buf->chunk_size;
+    return (char *)buf->tiles[chunk % buf->num_tiles] + tile_offset;
+}
+
+/**
+ * @brief Allocate a buffer in the interleaved L2 window
+ * @param size The size of the buffer, in bytes
+ * @return Pointer to the buffer, aligned to PB_L2_ALLOC_ALIGN, or NULL if
+ *         the window is disabled or has not enough free memory
+ * @note Unlike pb_l2_alloc_interleaved(), the buffer is contiguous: the
+ *       interleaving across memory tiles is done in hardware, at the
+ *       granularity of PB_L2_INTERLEAVE_BLOCK_SIZE.
+ */
+inline void *pb_l2_alloc_window(size_t size) {
+#if PB_L2_INTERLEAVE_ENABLE
+    size = PB_L2_ALLOC_ALIGN_UP(size);
+    if (pb_l2_window_used + size > PB_L2_INTERLEAVE_SIZE) return NULL;
+    uint32_t offset =
+        __atomic_fetch_add(&pb_l2_window_used, size, __ATOMIC_RELAXED);
+    if (offset + size > PB_L2_INTERLEAVE_SIZE) return NULL;
+    return (void *)((uintptr_t)PB_L2_INTERLEAVE_BASE_ADDR + offset);
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * @brief Get the memory tile address of a byte in the interleaved L2 window
+ * @param ptr Pointer to the byte in the window
+ * @note Mirrors `picobello_pkg::l2_interleave_addr`
+ */
+inline void *pb_l2_window_tile_ptr(void *ptr) {
+    uintptr_t offset = (uintptr_t)ptr - PB_L2_INTERLEAVE_BASE_ADDR;
+    uint32_t block = offset / PB_L2_INTERLEAVE_BLOCK_SIZE;
+    return (void *)(pb_l2_tile_address(block % PB_NUM_MEM_TILES) +
+                    PICOBELLO_ADDRMAP_L2_SPM_0_SIZE -
+                    PB_L2_INTERLEAVE_TILE_SIZE +
+                    (block / PB_NUM_MEM_TILES) * PB_L2_INTERLEAVE_BLOCK_SIZE +
+                    offset % PB_L2_INTERLEAVE_BLOCK_SIZE);
+}
@@ -5,11 +5,17 @@
 #include <stddef.h>
 #include <stdint.h>
 
-// TODO(colluca): add alias to addrmap so this can be properly implemented
 // Must return a pointer to the snitch_cluster_t struct
 // of the cluster alias.
+// The alias region maps to the local cluster in every cluster, so its
+// addresses are the same on all clusters. Falls back to the cluster's own
+// address range if the alias region is disabled.
 inline volatile snitch_cluster_t* snrt_cluster_alias() {
+#if PB_CLUSTER_ALIAS_ENABLE
+    return (volatile snitch_cluster_t*)PB_CLUSTER_ALIAS_BASE_ADDR;
+#else
     return snrt_cluster();
+#endif
 }
 
 // Must return a pointer to the snitch_cluster_t struct
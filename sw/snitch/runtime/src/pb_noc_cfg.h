@@ -1,8 +0,0 @@
-// Copyright 2025 ETH Zurich and University of Bologna.
-// Licensed under the Apache License, Version 2.0, see LICENSE for details.
-// SPDX-License-Identifier: Apache-2.0
-//
-// Lorenzo Leone <lleone@iis.ee.ethz.ch>
-
-#define PB_CLUSTER_PER_ROW 4
-#define PB_CLUSTER_PER_COL 4
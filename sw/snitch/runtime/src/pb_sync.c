@@ -0,0 +1,34 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+extern inline pb_comm_t pb_comm_init(uint32_t members,
+                                     pb_barrier_algo_t barrier_algo);
+
+extern inline void pb_comm_arrive(volatile uint32_t *counter, uint32_t dst);
+
+extern inline void pb_comm_release(pb_comm_t comm, const pb_mcast_t *mcasts,
+                                   uint32_t num_mcasts, uint32_t iteration);
+
+extern inline void pb_inter_cluster_barrier(pb_comm_t comm);
+
+extern inline void pb_global_barrier(pb_comm_t comm);
+
+extern inline void pb_comm_create(uint32_t members,
+                                  pb_barrier_algo_t barrier_algo,
+                                  pb_comm_t *comm);
+
+extern inline void pb_comm_split(pb_comm_t parent, uint32_t members,
+                                 pb_barrier_algo_t barrier_algo,
+                                 pb_comm_t *comm);
+
+extern inline void pb_comm_create_rect(uint32_t col, uint32_t row,
+                                       uint32_t num_cols, uint32_t num_rows,
+                                       pb_barrier_algo_t barrier_algo,
+                                       pb_comm_t *comm);
+
+extern inline void pb_comm_create_row(pb_barrier_algo_t barrier_algo,
+                                      pb_comm_t *comm);
+
+extern inline void pb_comm_create_col(pb_barrier_algo_t barrier_algo,
+                                      pb_comm_t *comm);
@@ -0,0 +1,291 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file
+ * @brief This file contains functions and types related to the
+ * synchronization of groups of clusters on the Picobello mesh.
+ *
+ * A Picobello communicator is a set of clusters together with the barrier
+ * algorithm used to synchronize them. All barrier state lives in the TCDM of
+ * the member clusters: arrivals are signalled with atomic increments on
+ * counters in the TCDM of another member, and members are released with
+ * multicast writes to a flag in their TCDM, on which they spin locally.
+ * Clusters outside of the communicator are never accessed, so disjoint
+ * communicators can synchronize concurrently without disturbing each other.
+ */
+
+// Maximum number of clusters in a communicator
+#define PB_COMM_MAX_CLUSTERS 32
+
+/**
+ * @brief Barrier algorithms
+ */
+typedef enum {
+    // All members signal their arrival to the root, which releases all
+    // members at once
+    PB_BARRIER_CENTRALIZED = 0,
+    // Members first signal their arrival to the head of their mesh row, and
+    // the row heads to the root. The root releases the row heads with
+    // column multicasts, which release their rows with row multicasts.
+    PB_BARRIER_HIERARCHICAL = 1
+} pb_barrier_algo_t;
+
+/**
+ * @brief Communicator state, allocated at the same TCDM offset in all
+ *        clusters
+ */
+typedef struct {
+    // Bitmap of the member clusters
+    uint32_t members;
+    uint32_t size;
+    uint32_t is_participant;
+    pb_barrier_algo_t barrier_algo;
+    // Root of the barrier, and head of the local cluster's row
+    uint32_t root;
+    uint32_t row_head;
+    // Number of arrivals the local cluster waits for, as root and row head
+    uint32_t num_root_arrivals;
+    uint32_t num_row_arrivals;
+    // Multicast groups released by the local cluster, as root and row head
+    uint32_t num_root_mcasts;
+    uint32_t num_row_mcasts;
+    pb_mcast_t root_mcasts[PB_COMM_MAX_CLUSTERS];
+    pb_mcast_t row_mcasts[PB_COMM_MAX_CLUSTERS];
+    // Number of barriers the local cluster went through
+    uint32_t iteration;
+    // Arrival counters, as root and row head, and release flag. They are
+    // monotonic, so they never need to be reset.
+    volatile uint32_t root_arrivals;
+    volatile uint32_t row_arrivals;
+    volatile uint32_t release;
+    // Number of point-to-point transfers received by the local cluster, and
+    // consumed, in the collectives of the communicator (see
+    // pb_collectives.h). Also monotonic.
+    volatile uint32_t rx_flag;
+    uint32_t rx_count;
+} pb_comm_info_t;
+
+typedef pb_comm_info_t *pb_comm_t;
+
+/**
+ * @brief Allocate and initialize the state of a communicator, without
+ *        synchronizing its members
+ */
+inline pb_comm_t pb_comm_init(uint32_t members,
+                              pb_barrier_algo_t barrier_algo) {
+    pb_comm_info_t *info = (pb_comm_info_t *)snrt_l1_alloc_cluster_local(
+        sizeof(pb_comm_info_t), alignof(pb_comm_info_t));
+
+    if (snrt_is_dm_core()) {
+        uint32_t cidx = snrt_cluster_idx();
+        info->members = members;
+        info->size = __builtin_popcount(members);
+        info->is_participant = (members >> cidx) & 1;
+        info->barrier_algo = barrier_algo;
+
+        // Row heads are the first member of every row, and the root is the
+        // head of the first row with members
+        uint32_t heads = 0, row_members = 0;
+        for (uint32_t c = 0; c < snrt_cluster_num(); c++) {
+            if (!((members >> c) & 1)) continue;
+            uint32_t row_bit = 1u << pb_cluster_row(c);
+            if (!(row_members & row_bit)) heads |= 1u << c;
+            row_members |= row_bit;
+        }
+        info->root = __builtin_ctz(heads ? heads : 1);
+        info->row_head = cidx;
+        uint32_t row = 0;
+        for (uint32_t c = 0; c < snrt_cluster_num(); c++) {
+            if (!((members >> c) & 1) || pb_cluster_row(c) != pb_cluster_row())
+                continue;
+            if (!row) info->row_head = c;
+            row |= 1u << c;
+        }
+
+        // Every release flag has a single writer, so that releases can't be
+        // reordered. The releasing cluster sets its own flag locally.
+        uint32_t self = 1u << cidx;
+        if (barrier_algo == PB_BARRIER_HIERARCHICAL) {
+            info->num_root_arrivals = __builtin_popcount(heads);
+            info->num_row_arrivals = __builtin_popcount(row);
+            info->num_root_mcasts =
+                pb_mcast_decompose(heads & ~self, info->root_mcasts);
+            info->num_row_mcasts =
+                pb_mcast_decompose(row & ~self, info->row_mcasts);
+        } else {
+            info->num_root_arrivals = info->size;
+            info->num_row_arrivals = 0;
+            info->num_root_mcasts =
+                pb_mcast_decompose(members & ~self, info->root_mcasts);
+            info->num_row_mcasts = 0;
+        }
+
+        info->iteration = 0;
+        info->root_arrivals = 0;
+        info->row_arrivals = 0;
+        info->release = 0;
+        info->rx_flag = 0;
+        info->rx_count = 0;
+    }
+    return info;
+}
+
+/**
+ * @brief Signal an arrival to a counter in the TCDM of another cluster
+ */
+inline void pb_comm_arrive(volatile uint32_t *counter, uint32_t dst) {
+    __atomic_add_fetch((volatile uint32_t *)snrt_remote_l1_ptr(
+                           (void *)counter, snrt_cluster_idx(), dst),
+                       1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Release the clusters in a set of multicast groups
+ */
+inline void pb_comm_release(pb_comm_t comm, const pb_mcast_t *mcasts,
+                            uint32_t num_mcasts, uint32_t iteration) {
+    for (uint32_t i = 0; i < num_mcasts; i++) {
+        volatile uint32_t *flag = (volatile uint32_t *)pb_mcast_addr(
+            (void *)&comm->release, mcasts[i]);
+        snrt_enable_multicast(mcasts[i].mask);
+        *flag = iteration;
+        snrt_disable_multicast();
+    }
+}
+
+/**
+ * @brief Synchronize the clusters in a communicator
+ * @param comm The communicator
+ * @note Must only be called by a single core in every cluster, typically
+ *       the DM core. Clusters outside of the communicator return
+ *       immediately.
+ */
+inline void pb_inter_cluster_barrier(pb_comm_t comm) {
+    if (!comm->is_participant) return;
+
+    uint32_t cidx = snrt_cluster_idx();
+    uint32_t iteration = ++comm->iteration;
+
+    if (comm->barrier_algo == PB_BARRIER_HIERARCHICAL) {
+        // Gather the arrivals of the row at the row head
+        pb_comm_arrive(&comm->row_arrivals, comm->row_head);
+        if (cidx == comm->row_head) {
+            while (comm->row_arrivals < iteration * comm->num_row_arrivals)
+                ;
+            // Gather the arrivals of the row heads at the root
+            pb_comm_arrive(&comm->root_arrivals, comm->root);
+            if (cidx == comm->root) {
+                while (comm->root_arrivals <
+                       iteration * comm->num_root_arrivals)
+                    ;
+                pb_comm_release(comm, comm->root_mcasts, comm->num_root_mcasts,
+                                iteration);
+                comm->release = iteration;
+            }
+            // Release the row once released by the root
+            while (comm->release < iteration)
+                ;
+            pb_comm_release(comm, comm->row_mcasts, comm->num_row_mcasts,
+                            iteration);
+        }
+    } else {
+        pb_comm_arrive(&comm->root_arrivals, comm->root);
+        if (cidx == comm->root) {
+            while (comm->root_arrivals < iteration * comm->num_root_arrivals)
+                ;
+            pb_comm_release(comm, comm->root_mcasts, comm->num_root_mcasts,
+                            iteration);
+            comm->release = iteration;
+        }
+    }
+
+    while (comm->release < iteration)
+        ;
+}
+
+/**
+ * @brief Synchronize all cores in the clusters of a communicator
+ * @param comm The communicator
+ * @note Must be called by all cores in the clusters of the communicator
+ */
+inline void pb_global_barrier(pb_comm_t comm) {
+    snrt_cluster_hw_barrier();
+    if (snrt_is_dm_core()) pb_inter_cluster_barrier(comm);
+    snrt_cluster_hw_barrier();
+}
+
+/**
+ * @brief Create a communicator
+ * @param members Bitmap of the clusters in the communicator
+ * @param barrier_algo The barrier algorithm of the communicator
+ * @param comm Pointer to the created communicator
+ * @note Must be called by all cores of all clusters, including the
+ *       clusters outside of the communicator, since it synchronizes them
+ *       to guarantee that the communicator is initialized before it is used.
+ *       Clusters may pass different members, to partition the mesh into
+ *       disjoint communicators in a single call, as long as all members of
+ *       a communicator pass the same set.
+ */
+inline void pb_comm_create(uint32_t members, pb_barrier_algo_t barrier_algo,
+                           pb_comm_t *comm) {
+    *comm = pb_comm_init(members, barrier_algo);
+    snrt_global_barrier();
+}
+
+/**
+ * @brief Create a communicator from a subset of the clusters of another
+ *        communicator
+ * @param parent The parent communicator
+ * @param members Bitmap of the clusters in the communicator, a subset of the
+ *                members of `parent`
+ * @param barrier_algo The barrier algorithm of the communicator
+ * @param comm Pointer to the created communicator
+ * @note Must be called by all cores of all clusters in `parent`, which are
+ *       the only clusters it synchronizes. As for pb_comm_create(), members
+ *       of `parent` may pass different members.
+ */
+inline void pb_comm_split(pb_comm_t parent, uint32_t members,
+                          pb_barrier_algo_t barrier_algo, pb_comm_t *comm) {
+    *comm = pb_comm_init(members, barrier_algo);
+    pb_global_barrier(parent);
+}
+
+/**
+ * @brief Create a communicator over a sub-rectangle of the mesh
+ * @param col The index of the leftmost column of the rectangle
+ * @param row The index of the bottom row of the rectangle
+ * @param num_cols The number of columns of the rectangle
+ * @param num_rows The number of rows of the rectangle
+ * @param barrier_algo The barrier algorithm of the communicator
+ * @param comm Pointer to the created communicator
+ * @note Same calling convention as pb_comm_create()
+ */
+inline void pb_comm_create_rect(uint32_t col, uint32_t row, uint32_t num_cols,
+                                uint32_t num_rows,
+                                pb_barrier_algo_t barrier_algo,
+                                pb_comm_t *comm) {
+    pb_comm_create(pb_cluster_rect(col, row, num_cols, num_rows), barrier_algo,
+                   comm);
+}
+
+/**
+ * @brief Create a communicator over the NoC row of the calling cluster
+ * @note Same calling convention as pb_comm_create(). Every row gets its own
+ *       communicator.
+ */
+inline void pb_comm_create_row(pb_barrier_algo_t barrier_algo,
+                               pb_comm_t *comm) {
+    pb_comm_create(pb_cluster_row_set(pb_cluster_row()), barrier_algo, comm);
+}
+
+/**
+ * @brief Create a communicator over the NoC column of the calling cluster
+ * @note Same calling convention as pb_comm_create(). Every column gets its
+ *       own communicator.
+ */
+inline void pb_comm_create_col(pb_barrier_algo_t barrier_algo,
+                               pb_comm_t *comm) {
+    pb_comm_create(pb_cluster_col_set(pb_cluster_col()), barrier_algo, comm);
+}
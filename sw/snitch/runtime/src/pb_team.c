@@ -14,6 +14,55 @@ extern inline uint32_t pb_cluster_col(uint32_t cidx);
 
 extern inline uint32_t pb_cluster_col();
 
+extern inline uint32_t pb_cluster_x(uint32_t cidx);
+
+extern inline uint32_t pb_cluster_y(uint32_t cidx);
+
+extern inline uint32_t pb_mem_tile_x(uint32_t tile_idx);
+
+extern inline uint32_t pb_mem_tile_y(uint32_t tile_idx);
+
+extern inline uint32_t pb_hops(uint32_t x0, uint32_t y0, uint32_t x1,
+                               uint32_t y1);
+
+extern inline uint32_t pb_cluster_hops(uint32_t src, uint32_t dst);
+
+extern inline uint32_t pb_mem_tile_hops(uint32_t cidx, uint32_t tile_idx);
+
+extern inline int32_t pb_cluster_neighbour(uint32_t cidx, pb_dir_t dir);
+
+extern inline uint32_t pb_cluster_rect(uint32_t col, uint32_t row,
+                                       uint32_t num_cols, uint32_t num_rows);
+
+extern inline uint32_t pb_cluster_row_set(uint32_t row);
+
+extern inline uint32_t pb_cluster_col_set(uint32_t col);
+
 extern inline uint32_t pb_closest_mem_tile(uint32_t cidx);
 
 extern inline uint32_t pb_closest_mem_tile();
+
+extern inline uint32_t pb_mcast_row_mask();
+
+extern inline uint32_t pb_mcast_col_mask();
+
+extern inline pb_mcast_t pb_mcast_row(uint32_t row);
+
+extern inline pb_mcast_t pb_mcast_col(uint32_t col);
+
+extern inline pb_mcast_t pb_mcast_rect(uint32_t col, uint32_t row,
+                                       uint32_t num_cols, uint32_t num_rows);
+
+extern inline uint32_t pb_mcast_contains(pb_mcast_t mcast, uint32_t cidx);
+
+extern inline void *pb_mcast_addr(void *ptr, pb_mcast_t mcast);
+
+extern inline uint32_t pb_mcast_members(uint32_t base, uint32_t cluster_mask);
+
+extern inline uint32_t pb_mcast_search(uint32_t clusters, uint32_t uncovered,
+                                       uint32_t num_bits, uint32_t depth,
+                                       pb_mcast_t *mcasts,
+                                       uint32_t *num_mcasts);
+
+extern inline uint32_t pb_mcast_decompose(uint32_t clusters,
+                                          pb_mcast_t *mcasts);
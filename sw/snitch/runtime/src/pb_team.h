@@ -38,7 +38,7 @@ inline uintptr_t pb_l2_tile_offset(uintptr_t src_addr) {
  */
 inline uint32_t pb_cluster_row(uint32_t cidx)
 {
-    return cidx % PB_CLUSTER_PER_ROW;
+    return cidx % PB_CLUSTER_PER_COL;
 }
 
 /**
@@ -73,17 +73,156 @@ inline uint32_t pb_cluster_col()
 }
 
 
+/**
+ * @brief Get the X coordinate of a cluster in the NoC mesh
+ * @param cidx The cluster index
+ * @return The X coordinate of the router the cluster is connected to
+ */
+inline uint32_t pb_cluster_x(uint32_t cidx) {
+    return PB_CLUSTER_X_OFFSET + pb_cluster_col(cidx);
+}
+
+/**
+ * @brief Get the Y coordinate of a cluster in the NoC mesh
+ * @param cidx The cluster index
+ * @return The Y coordinate of the router the cluster is connected to
+ */
+inline uint32_t pb_cluster_y(uint32_t cidx) {
+    return PB_CLUSTER_Y_OFFSET + pb_cluster_row(cidx);
+}
+
+/**
+ * @brief Get the X coordinate of a memory tile in the NoC mesh
+ * @param tile_idx The memory tile index
+ * @return The X coordinate of the router the memory tile is connected to
+ */
+inline uint32_t pb_mem_tile_x(uint32_t tile_idx) {
+    static const uint8_t mem_tile_x[PB_NUM_MEM_TILES] = PB_MEM_TILE_X;
+    return mem_tile_x[tile_idx];
+}
+
+/**
+ * @brief Get the Y coordinate of a memory tile in the NoC mesh
+ * @param tile_idx The memory tile index
+ * @return The Y coordinate of the router the memory tile is connected to
+ */
+inline uint32_t pb_mem_tile_y(uint32_t tile_idx) {
+    static const uint8_t mem_tile_y[PB_NUM_MEM_TILES] = PB_MEM_TILE_Y;
+    return mem_tile_y[tile_idx];
+}
+
+/**
+ * @brief Get the number of hops between two routers of the NoC mesh
+ * @note Assumes XY routing, so that the number of hops is the Manhattan
+ *       distance between the routers
+ */
+inline uint32_t pb_hops(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+    uint32_t dx = x0 > x1 ? x0 - x1 : x1 - x0;
+    uint32_t dy = y0 > y1 ? y0 - y1 : y1 - y0;
+    return dx + dy;
+}
+
+/**
+ * @brief Get the number of hops between two clusters
+ * @param src The source cluster index
+ * @param dst The destination cluster index
+ * @return The number of NoC hops from src to dst
+ */
+inline uint32_t pb_cluster_hops(uint32_t src, uint32_t dst) {
+    return pb_hops(pb_cluster_x(src), pb_cluster_y(src), pb_cluster_x(dst),
+                   pb_cluster_y(dst));
+}
+
+/**
+ * @brief Get the number of hops between a cluster and a memory tile
+ * @param cidx The cluster index
+ * @param tile_idx The memory tile index
+ * @return The number of NoC hops between the cluster and the memory tile
+ */
+inline uint32_t pb_mem_tile_hops(uint32_t cidx, uint32_t tile_idx) {
+    return pb_hops(pb_cluster_x(cidx), pb_cluster_y(cidx),
+                   pb_mem_tile_x(tile_idx), pb_mem_tile_y(tile_idx));
+}
+
+/**
+ * @brief Directions of the links of a router in the NoC mesh
+ */
+typedef enum {
+    PB_NORTH = 0,
+    PB_EAST = 1,
+    PB_SOUTH = 2,
+    PB_WEST = 3
+} pb_dir_t;
+
+/**
+ * @brief Get the cluster on the other side of a link
+ * @param cidx The cluster index
+ * @param dir The direction of the link
+ * @return Index of the neighbouring cluster, or -1 if the link does not lead
+ *         to a cluster (e.g. the mesh boundary or a memory tile)
+ */
+inline int32_t pb_cluster_neighbour(uint32_t cidx, pb_dir_t dir) {
+    uint32_t row = pb_cluster_row(cidx);
+    uint32_t col = pb_cluster_col(cidx);
+    switch (dir) {
+        case PB_NORTH:
+            return (row + 1 < PB_CLUSTER_PER_COL) ? (int32_t)cidx + 1 : -1;
+        case PB_SOUTH:
+            return (row > 0) ? (int32_t)cidx - 1 : -1;
+        case PB_EAST:
+            return (col + 1 < PB_CLUSTER_PER_ROW)
+                       ? (int32_t)(cidx + PB_CLUSTER_PER_COL)
+                       : -1;
+        case PB_WEST:
+            return (col > 0) ? (int32_t)(cidx - PB_CLUSTER_PER_COL) : -1;
+    }
+    return -1;
+}
+
+/**
+ * @brief Get the set of clusters in a sub-rectangle of the mesh
+ * @param col The index of the leftmost column of the rectangle
+ * @param row The index of the bottom row of the rectangle
+ * @param num_cols The number of columns of the rectangle
+ * @param num_rows The number of rows of the rectangle
+ * @return Bitmap with bit `cidx` set for every cluster in the rectangle
+ */
+inline uint32_t pb_cluster_rect(uint32_t col, uint32_t row, uint32_t num_cols,
+                                uint32_t num_rows) {
+    uint32_t col_bits = ((1u << num_rows) - 1) << row;
+    uint32_t clusters = 0;
+    for (uint32_t c = col; c < col + num_cols; c++)
+        clusters |= col_bits << (c * PB_CLUSTER_PER_COL);
+    return clusters;
+}
+
+/**
+ * @brief Get the set of clusters in a NoC row
+ * @param row The row index
+ * @return Bitmap with bit `cidx` set for every cluster in the row
+ */
+inline uint32_t pb_cluster_row_set(uint32_t row) {
+    return pb_cluster_rect(0, row, PB_CLUSTER_PER_ROW, 1);
+}
+
+/**
+ * @brief Get the set of clusters in a NoC column
+ * @param col The column index
+ * @return Bitmap with bit `cidx` set for every cluster in the column
+ */
+inline uint32_t pb_cluster_col_set(uint32_t col) {
+    return pb_cluster_rect(col, 0, 1, PB_CLUSTER_PER_COL);
+}
+
 /**
  * @brief Get the index of the closest memory tile
  * @param cidx The cluster index
- * @return Index of the closest memory tile to cidx
+ * @return Index of the memory tile with the fewest hops to cidx. On ties,
+ *         the lowest index is returned.
  */
 inline uint32_t pb_closest_mem_tile(uint32_t cidx) {
-    uint32_t row = pb_cluster_row(cidx);
-    // e.g. with 4x4 matrix
-    // first 8 clusters -> left column tiles 0..3
-    // clusters >= 8 -> right column tiles 4..7
-    return (cidx < (snrt_cluster_num() / 2)) ? row : (row + PB_CLUSTER_PER_COL);
+    static const uint8_t closest_mem_tile[] = PB_CLOSEST_MEM_TILE;
+    return closest_mem_tile[cidx];
 }
 
 /**
@@ -93,3 +232,186 @@ inline uint32_t pb_closest_mem_tile(uint32_t cidx) {
 inline uint32_t pb_closest_mem_tile() {
     return pb_closest_mem_tile(snrt_cluster_idx());
 }
+
+/**
+ * @brief Get the multicast mask selecting all clusters in the same NoC row
+ * @return Multicast mask to be used with snrt_enable_multicast() or the
+ *         DMA multicast functions
+ * @note Assumes the number of clusters per row is a power of two
+ */
+inline uint32_t pb_mcast_row_mask() {
+    return (PB_CLUSTER_PER_ROW - 1) * PB_CLUSTER_PER_COL * SNRT_CLUSTER_OFFSET;
+}
+
+/**
+ * @brief Get the multicast mask selecting all clusters in the same NoC column
+ * @return Multicast mask to be used with snrt_enable_multicast() or the
+ *         DMA multicast functions
+ * @note Assumes the number of clusters per column is a power of two
+ */
+inline uint32_t pb_mcast_col_mask() {
+    return (PB_CLUSTER_PER_COL - 1) * SNRT_CLUSTER_OFFSET;
+}
+
+/**
+ * @brief Group of clusters reached by a single multicast transaction
+ *
+ * Clusters are selected by the bits of their index which are not set in the
+ * multicast mask: a transaction reaches all clusters whose index matches
+ * `cluster` on those bits. With the cluster index being
+ * col * PB_CLUSTER_PER_COL + row, a group is thus an aligned power-of-two
+ * sub-rectangle of the mesh, or a strided set thereof.
+ */
+typedef struct {
+    // Index of the first cluster in the group
+    uint32_t cluster;
+    // Multicast mask, to be used with snrt_enable_multicast() or the DMA
+    // multicast functions
+    uint32_t mask;
+} pb_mcast_t;
+
+/**
+ * @brief Get the multicast group of all clusters in a NoC row
+ * @param row The row index
+ * @note Assumes the number of clusters per row is a power of two
+ */
+inline pb_mcast_t pb_mcast_row(uint32_t row) {
+    return (pb_mcast_t){row, pb_mcast_row_mask()};
+}
+
+/**
+ * @brief Get the multicast group of all clusters in a NoC column
+ * @param col The column index
+ * @note Assumes the number of clusters per column is a power of two
+ */
+inline pb_mcast_t pb_mcast_col(uint32_t col) {
+    return (pb_mcast_t){col * PB_CLUSTER_PER_COL, pb_mcast_col_mask()};
+}
+
+/**
+ * @brief Get the multicast group of a sub-rectangle of the mesh
+ * @param col The index of the leftmost column of the rectangle
+ * @param row The index of the bottom row of the rectangle
+ * @param num_cols The number of columns of the rectangle
+ * @param num_rows The number of rows of the rectangle
+ * @note The rectangle sizes must be powers of two, and its position a
+ *       multiple of its size. Assumes the number of clusters per column is
+ *       a power of two.
+ */
+inline pb_mcast_t pb_mcast_rect(uint32_t col, uint32_t row, uint32_t num_cols,
+                                uint32_t num_rows) {
+    uint32_t cluster_mask = (num_cols - 1) * PB_CLUSTER_PER_COL + num_rows - 1;
+    return (pb_mcast_t){col * PB_CLUSTER_PER_COL + row,
+                        cluster_mask * SNRT_CLUSTER_OFFSET};
+}
+
+/**
+ * @brief Check whether a cluster belongs to a multicast group
+ */
+inline uint32_t pb_mcast_contains(pb_mcast_t mcast, uint32_t cidx) {
+    uint32_t cluster_mask = mcast.mask / SNRT_CLUSTER_OFFSET;
+    return (cidx & ~cluster_mask) == mcast.cluster;
+}
+
+/**
+ * @brief Get the address to target with a multicast transaction
+ * @param ptr Pointer into the local TCDM, to be written in all clusters of
+ *            the group
+ * @param mcast The multicast group
+ * @return The address of `ptr` in a cluster of the group other than the
+ *         local one (where possible), since transactions addressed to the
+ *         local cluster do not enter the NoC
+ */
+inline void *pb_mcast_addr(void *ptr, pb_mcast_t mcast) {
+    uint32_t cluster_mask = mcast.mask / SNRT_CLUSTER_OFFSET;
+    uint32_t dst = mcast.cluster;
+    if (dst == snrt_cluster_idx()) dst |= cluster_mask & -cluster_mask;
+    return snrt_remote_l1_ptr(ptr, snrt_cluster_idx(), dst);
+}
+
+/**
+ * @brief Get the bitmap of the members of a multicast group
+ * @param base The first member of the group
+ * @param cluster_mask The multicast mask, in cluster indices
+ */
+inline uint32_t pb_mcast_members(uint32_t base, uint32_t cluster_mask) {
+    // Enumerate the submasks of the multicast mask
+    uint32_t members = 0, sub = cluster_mask;
+    do {
+        members |= 1u << (base | sub);
+        sub = (sub - 1) & cluster_mask;
+    } while (sub != cluster_mask);
+    return members;
+}
+
+/**
+ * @brief Search the covers of a set of clusters with fewer groups than the
+ *        best cover found so far, see pb_mcast_decompose()
+ * @param clusters Bitmap of the clusters in the set
+ * @param uncovered Bitmap of the clusters not covered yet
+ * @param num_bits Number of bits of the cluster index
+ * @param depth Number of groups in the cover so far
+ * @param mcasts Best cover found so far
+ * @param num_mcasts Number of groups of the best cover found so far
+ * @return Whether a better cover was found, in which case its groups from
+ *         `depth` on are written to `mcasts`
+ */
+inline uint32_t pb_mcast_search(uint32_t clusters, uint32_t uncovered,
+                                uint32_t num_bits, uint32_t depth,
+                                pb_mcast_t *mcasts, uint32_t *num_mcasts) {
+    if (!uncovered) {
+        *num_mcasts = depth;
+        return 1;
+    }
+    if (depth + 1 >= *num_mcasts) return 0;
+
+    // The first uncovered cluster is covered by one of the largest groups
+    // containing it which are contained in the set. Larger groups are tried
+    // first, to find a good cover early.
+    uint32_t first = __builtin_ctz(uncovered);
+    uint32_t found = 0;
+    uint32_t mask = 1u << num_bits;
+    while (mask--) {
+        uint32_t base = first & ~mask;
+        uint32_t members = pb_mcast_members(base, mask);
+        if ((members & clusters) != members) continue;
+        uint32_t largest = 1;
+        for (uint32_t bit = 1; bit < (1u << num_bits); bit <<= 1) {
+            if (mask & bit) continue;
+            uint32_t larger = pb_mcast_members(base & ~bit, mask | bit);
+            if ((larger & clusters) == larger) largest = 0;
+        }
+        if (!largest) continue;
+        if (pb_mcast_search(clusters, uncovered & ~members, num_bits,
+                            depth + 1, mcasts, num_mcasts)) {
+            mcasts[depth].cluster = base;
+            mcasts[depth].mask = mask * SNRT_CLUSTER_OFFSET;
+            found = 1;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Decompose a set of clusters into the fewest multicast groups
+ *
+ * Groups never include clusters outside of the set, but may overlap. The
+ * cover is found by an exhaustive branch-and-bound search, which is cheap
+ * for meshes of a few tens of clusters.
+ *
+ * @param clusters Bitmap of the clusters in the set
+ * @param mcasts Output array of multicast groups, with room for at least as
+ *               many groups as clusters in the set
+ * @return The number of multicast groups
+ */
+inline uint32_t pb_mcast_decompose(uint32_t clusters, pb_mcast_t *mcasts) {
+    // Number of bits of the cluster index
+    uint32_t num_bits = 0;
+    while ((1u << num_bits) < snrt_cluster_num()) num_bits++;
+
+    // Any cover beats one with a group more than there are clusters
+    if (!clusters) return 0;
+    uint32_t num_mcasts = __builtin_popcount(clusters) + 1;
+    pb_mcast_search(clusters, clusters, num_bits, 0, mcasts, &num_mcasts);
+    return num_mcasts;
+}
@@ -49,6 +49,9 @@
 #define REDMULE_ARCHI_CL_EVT_ACC0 0
 #define REDMULE_ARCHI_CL_EVT_ACC1 1
 
+// Number of job contexts, i.e. jobs which can be offloaded at the same time
+#define REDMULE_NUM_CONTEXTS 2
+
 // Base address
 #define REDMULE_BASE_ADD (unsigned long)snrt_cluster()->zeromem.mem+sizeof(snrt_cluster()->zeromem.mem)
 
@@ -52,6 +52,8 @@ static inline int redmule_acquire_job() { return REDMULE_READ(REDMULE_ACQUIRE);
 
 static inline unsigned int redmule_get_status() { return REDMULE_READ(REDMULE_STATUS); }
 
+static inline int redmule_get_running_job() { return REDMULE_READ(REDMULE_RUNNING_JOB); }
+
 static inline void redmule_soft_clear() {
   volatile int i;
   REDMULE_WRITE(0, REDMULE_SOFT_CLEAR);
@@ -0,0 +1,443 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+/**
+ * @file
+ * @brief Tiled GEMM on the cluster's RedMulE, streaming its operands from L2.
+ *
+ * Following the RedMulE convention, Z[M x K] = X[M x N] * W[N x K] (+ Y),
+ * where N is the reduction dimension. The matrices can be of any size: they
+ * are split into tiles which fit in TCDM, and every RedMulE job computes
+ * the product of an X and a W tile. The jobs of an output tile run back to
+ * back, accumulating into the same Z tile in TCDM.
+ *
+ * The DM core streams the tiles with a three-stage pipeline: while RedMulE
+ * computes a job, the operands of the next job are already programmed in
+ * the second job context (see redmule_queue.h), and the DM core loads the
+ * operands of the job after that. Output tiles are written back once their
+ * last job completes.
+ *
+ * redmule_gemm() runs on a single cluster, while redmule_gemm_parallel()
+ * splits Z across all clusters of the mesh.
+ *
+ * Besides the GEMM, the GEMM-OPS of RedMulE compute semiring products, e.g.
+ * REDMULE_ADDMIN computes Z = min(Y, min_n(X + W)) as in tropical matrix
+ * products, for shortest paths, max-plus scheduling or Viterbi decoding.
+ *
+ * W may be quantized (see redmule_gemm_quant_t), in which case its tiles
+ * are moved in their packed form, together with their dequantization
+ * parameters, and dequantized by RedMulE.
+ */
+
+// Number of buffers per operand, i.e. depth of the pipeline
+#define REDMULE_GEMM_NUM_BUFFERS 3
+
+// Default tile size along every dimension
+#define REDMULE_GEMM_TILE_SIZE 64
+
+/**
+ * @brief Quantized W, with its dequantization parameters (see redmule_cfg()).
+ *
+ * W, G, S and B are stored pre-tiled, in the layout RedMulE expects for a
+ * single job on a tile_n x tile_k tile of W. The part of every array
+ * belonging to the tile at (row, col) of the tile grid is found at index
+ * col * (N / tile_n) + row, so that consecutive jobs stream consecutive
+ * tiles. N and K must therefore be multiples of the tile sizes, as clipped
+ * to the matrices, otherwise the GEMM is rejected.
+ */
+typedef struct {
+  // Quantized format, e.g. REDMULE_Q_INT4
+  uint8_t q_fmt;
+  // Pre-tiled arrays, W being the one of redmule_gemm_args_t
+  const void *g;
+  const void *s;
+  const void *b;
+  // Size in bytes of the part of every array belonging to a tile
+  uint32_t w_tile_size;
+  uint32_t g_tile_size;
+  uint32_t s_tile_size;
+  uint32_t b_tile_size;
+} redmule_gemm_quant_t;
+
+typedef struct {
+  // Operands in L2. Y is optional, and may alias Z to accumulate into it.
+  const void *x;
+  const void *w;
+  const void *y;
+  void *z;
+  // Matrix sizes
+  uint32_t m;
+  uint32_t n;
+  uint32_t k;
+  // Leading dimensions, in elements. Y has the same layout as Z.
+  uint32_t ldx;
+  uint32_t ldw;
+  uint32_t ldz;
+  // Input/output format, e.g. REDMULE_Float16
+  uint8_t fmt;
+  // Operation, REDMULE_MATMUL (zero) and REDMULE_GEMM both computing
+  // X * W (+ Y). With one of the GEMM-OPS, e.g. REDMULE_ADDMIN, Y is
+  // required, as the semirings have no identity element RedMulE starts from,
+  // and the GEMM is rejected without it.
+  uint8_t op;
+  // Tile sizes, zero selects REDMULE_GEMM_TILE_SIZE
+  uint32_t tile_m;
+  uint32_t tile_n;
+  uint32_t tile_k;
+  // Quantization of W, or NULL if W is in `fmt`
+  const redmule_gemm_quant_t *quant;
+} redmule_gemm_args_t;
+
+// Size in bytes of an element in a RedMulE format
+static inline uint32_t redmule_fmt_size(uint8_t fmt) {
+  return (fmt == REDMULE_Float16 || fmt == REDMULE_Float16Alt) ? 2 : 1;
+}
+
+// Block of Z computed by a cluster, and how the cluster obtains the X and W
+// tiles of the block
+typedef struct {
+  // First row and column of the block, and its nominal size. The block is
+  // clipped at the matrix edges.
+  uint32_t row;
+  uint32_t col;
+  uint32_t m;
+  uint32_t k;
+  // Whether the cluster loads the X and W tiles from L2, and whether it
+  // then multicasts them to a group of clusters computing the same job
+  // sequence. Clusters which don't load a tile receive it by multicast.
+  int load_x;
+  int load_w;
+  int mcast_x;
+  int mcast_w;
+  pb_mcast_t x_mcast;
+  pb_mcast_t w_mcast;
+  // Communicator synchronizing the clusters exchanging tiles, or NULL
+  pb_comm_t comm;
+} redmule_gemm_block_t;
+
+// Job of the tiled GEMM. Jobs iterate over the output tiles of a block,
+// row-major, and over the reduction dimension within an output tile.
+typedef struct {
+  // Output tile index, and first row and column of the tiles
+  uint32_t tile;
+  uint32_t row;
+  uint32_t col;
+  uint32_t red;
+  // Tile sizes, smaller than the nominal ones at the matrix edges, and zero
+  // outside of the matrices
+  uint32_t tm;
+  uint32_t tn;
+  uint32_t tk;
+  // First and last job of the output tile
+  int first;
+  int last;
+} redmule_gemm_job_t;
+
+static inline uint32_t redmule_gemm_clip(uint32_t start, uint32_t size, uint32_t end) {
+  if (start >= end) return 0;
+  return (end - start < size) ? end - start : size;
+}
+
+static inline redmule_gemm_job_t redmule_gemm_job(const redmule_gemm_args_t *args,
+                                                  const redmule_gemm_block_t *blk,
+                                                  uint32_t tile_m, uint32_t tile_n,
+                                                  uint32_t tile_k, uint32_t idx) {
+  uint32_t n_tiles = (args->n + tile_n - 1) / tile_n;
+  uint32_t k_tiles = (blk->k + tile_k - 1) / tile_k;
+  uint32_t ni = idx % n_tiles;
+  uint32_t row_end = (blk->row + blk->m < args->m) ? blk->row + blk->m : args->m;
+  uint32_t col_end = (blk->col + blk->k < args->k) ? blk->col + blk->k : args->k;
+  redmule_gemm_job_t job;
+  job.tile = idx / n_tiles;
+  job.row = blk->row + (job.tile / k_tiles) * tile_m;
+  job.col = blk->col + (job.tile % k_tiles) * tile_k;
+  job.red = ni * tile_n;
+  job.tm = redmule_gemm_clip(job.row, tile_m, row_end);
+  job.tn = redmule_gemm_clip(job.red, tile_n, args->n);
+  job.tk = redmule_gemm_clip(job.col, tile_k, col_end);
+  job.first = ni == 0;
+  job.last = ni == n_tiles - 1;
+  return job;
+}
+
+// Copy a rows x cols tile between a matrix with leading dimension `ld` and
+// a contiguous buffer
+static inline void redmule_gemm_load(void *dst, const void *src, uint32_t row, uint32_t col,
+                                     uint32_t rows, uint32_t cols, uint32_t ld, uint32_t prec) {
+  snrt_dma_start_2d(dst, (const void *)((uintptr_t)src + (row * ld + col) * prec), cols * prec,
+                    cols * prec, ld * prec, rows);
+}
+
+static inline void redmule_gemm_store(void *dst, const void *src, uint32_t row, uint32_t col,
+                                      uint32_t rows, uint32_t cols, uint32_t ld, uint32_t prec) {
+  snrt_dma_start_2d((void *)((uintptr_t)dst + (row * ld + col) * prec), src, cols * prec,
+                    ld * prec, cols * prec, rows);
+}
+
+// Offsets of the sections of a quantized W tile buffer, holding the W, G,
+// S and B parts of the tile
+typedef struct {
+  uint32_t g;
+  uint32_t s;
+  uint32_t b;
+  uint32_t size;
+} redmule_gemm_quant_layout_t;
+
+static inline redmule_gemm_quant_layout_t redmule_gemm_quant_layout(const redmule_gemm_quant_t *q) {
+  redmule_gemm_quant_layout_t l;
+  l.g = (q->w_tile_size + 63) & ~63;
+  l.s = l.g + ((q->g_tile_size + 63) & ~63);
+  l.b = l.s + ((q->s_tile_size + 63) & ~63);
+  l.size = l.b + q->b_tile_size;
+  return l;
+}
+
+// Load a quantized W tile, in its packed form
+static inline void redmule_gemm_load_quant(void *dst, const void *w, const redmule_gemm_quant_t *q,
+                                           uint32_t tile) {
+  redmule_gemm_quant_layout_t l = redmule_gemm_quant_layout(q);
+  snrt_dma_start_1d(dst, (const char *)w + tile * q->w_tile_size, q->w_tile_size);
+  snrt_dma_start_1d((char *)dst + l.g, (const char *)q->g + tile * q->g_tile_size,
+                    q->g_tile_size);
+  snrt_dma_start_1d((char *)dst + l.s, (const char *)q->s + tile * q->s_tile_size,
+                    q->s_tile_size);
+  snrt_dma_start_1d((char *)dst + l.b, (const char *)q->b + tile * q->b_tile_size,
+                    q->b_tile_size);
+}
+
+// Tile sizes of a GEMM, never exceeding the matrices
+static inline void redmule_gemm_tile_sizes(const redmule_gemm_args_t *args, uint32_t *tile_m,
+                                           uint32_t *tile_n, uint32_t *tile_k) {
+  *tile_m = args->tile_m ? args->tile_m : REDMULE_GEMM_TILE_SIZE;
+  *tile_n = args->tile_n ? args->tile_n : REDMULE_GEMM_TILE_SIZE;
+  *tile_k = args->tile_k ? args->tile_k : REDMULE_GEMM_TILE_SIZE;
+  if (*tile_m > args->m) *tile_m = args->m;
+  if (*tile_n > args->n) *tile_n = args->n;
+  if (*tile_k > args->k) *tile_k = args->k;
+}
+
+// Check that a GEMM is supported with the given tile sizes. Returns zero if
+// it is.
+static inline int redmule_gemm_check(const redmule_gemm_args_t *args, uint32_t tile_n,
+                                     uint32_t tile_k) {
+  // The GEMM-OPS start from Y, as their semirings have no identity element
+  if (args->op > REDMULE_GEMM && !args->y) return 1;
+  // A quantized W is pre-tiled for the tile sizes (see redmule_gemm_quant_t)
+  if (args->quant && (args->n % tile_n || args->k % tile_k)) return 1;
+  return 0;
+}
+
+// Compute a block of Z on the cluster's RedMulE, see redmule_gemm(). All
+// clusters synchronized by the block's communicator must run the same
+// number of jobs, so that the tiles they exchange match.
+static inline void redmule_gemm_block(const redmule_gemm_args_t *args,
+                                      const redmule_gemm_block_t *blk) {
+  const uint32_t nb = REDMULE_GEMM_NUM_BUFFERS;
+  uint32_t prec = redmule_fmt_size(args->fmt);
+  uint32_t tile_m, tile_n, tile_k;
+  redmule_gemm_tile_sizes(args, &tile_m, &tile_n, &tile_k);
+  uint32_t num_jobs = ((blk->m + tile_m - 1) / tile_m) * ((args->n + tile_n - 1) / tile_n) *
+                      ((blk->k + tile_k - 1) / tile_k);
+
+  const redmule_gemm_quant_t *quant = args->quant;
+  redmule_gemm_quant_layout_t ql = {0};
+  if (quant) ql = redmule_gemm_quant_layout(quant);
+  uint32_t w_buf_size = quant ? ql.size : tile_n * tile_k * prec;
+
+  // Allocate the tile buffers, at the same offset in all clusters. X and W
+  // buffers are indexed by job, Z buffers by output tile.
+  void *heap = snrt_l1_next_v2();
+  void *x_buf[nb], *w_buf[nb], *z_buf[nb];
+  for (uint32_t i = 0; i < nb; i++) {
+    x_buf[i] = snrt_l1_alloc_cluster_local(tile_m * tile_n * prec, 64);
+    w_buf[i] = snrt_l1_alloc_cluster_local(w_buf_size, 64);
+    z_buf[i] = snrt_l1_alloc_cluster_local(tile_m * tile_k * prec, 64);
+  }
+
+  int driver = snrt_cluster_core_idx() == 0;
+  redmule_queue_t queue;
+  redmule_job_t handle[nb];
+  if (driver) redmule_queue_init(&queue);
+
+  // In step s, the DM core loads the operands of job s, the driver submits
+  // job s - 1 and waits for job s - 2 to free its buffers, and the DM core
+  // stores the output tile of job s - 3, if it was the last of its tile.
+  // Jobs outside of the matrices only take part in the tile exchange.
+  for (uint32_t s = 0; s < num_jobs + nb; s++) {
+    if (snrt_is_dm_core()) {
+      if (s >= nb) {
+        redmule_gemm_job_t job = redmule_gemm_job(args, blk, tile_m, tile_n, tile_k, s - nb);
+        if (job.last && job.tm && job.tk) {
+          redmule_gemm_store(args->z, z_buf[job.tile % nb], job.row, job.col, job.tm, job.tk,
+                             args->ldz, prec);
+          // The Z buffer may be reloaded right away
+          snrt_dma_wait_all();
+        }
+      }
+      if (s < num_jobs) {
+        redmule_gemm_job_t job = redmule_gemm_job(args, blk, tile_m, tile_n, tile_k, s);
+        uint32_t x_size = job.tm * job.tn * prec;
+        uint32_t w_size = job.tk ? (quant ? ql.size : job.tn * job.tk * prec) : 0;
+        if (blk->load_x && x_size)
+          redmule_gemm_load(x_buf[s % nb], args->x, job.row, job.red, job.tm, job.tn,
+                            args->ldx, prec);
+        if (blk->load_w && w_size && quant)
+          redmule_gemm_load_quant(w_buf[s % nb], args->w, quant,
+                                  (job.col / tile_k) * (args->n / tile_n) + job.red / tile_n);
+        else if (blk->load_w && w_size)
+          redmule_gemm_load(w_buf[s % nb], args->w, job.red, job.col, job.tn, job.tk,
+                            args->ldw, prec);
+        if (job.first && args->y && job.tm && job.tk)
+          redmule_gemm_load(z_buf[job.tile % nb], args->y, job.row, job.col, job.tm, job.tk,
+                            args->ldz, prec);
+        snrt_dma_wait_all();
+        if (blk->mcast_x && x_size)
+          snrt_dma_start_1d_mcast(pb_mcast_addr(x_buf[s % nb], blk->x_mcast), x_buf[s % nb],
+                                  x_size, blk->x_mcast.mask);
+        if (blk->mcast_w && w_size)
+          snrt_dma_start_1d_mcast(pb_mcast_addr(w_buf[s % nb], blk->w_mcast), w_buf[s % nb],
+                                  w_size, blk->w_mcast.mask);
+      }
+      snrt_dma_wait_all();
+    }
+
+    if (driver) {
+      if (s >= 1 && s - 1 < num_jobs) {
+        redmule_gemm_job_t job = redmule_gemm_job(args, blk, tile_m, tile_n, tile_k, s - 1);
+        // The first job of a tile initializes Z, unless there is a Y. The
+        // GEMM-OPS always accumulate into Z.
+        uint8_t op = REDMULE_GEMM;
+        if (args->op > REDMULE_GEMM)
+          op = args->op;
+        else if (job.first && !args->y)
+          op = REDMULE_MATMUL;
+        unsigned int x = (unsigned int)x_buf[(s - 1) % nb];
+        unsigned int w = (unsigned int)w_buf[(s - 1) % nb];
+        unsigned int z = (unsigned int)z_buf[job.tile % nb];
+        if (job.tm && job.tk && quant)
+          handle[(s - 1) % nb] = redmule_queue_submit(&queue, x, w, z, w + ql.g, w + ql.s,
+                                                      w + ql.b, job.tm, job.tn, job.tk, op,
+                                                      args->fmt, 1, quant->q_fmt);
+        else if (job.tm && job.tk)
+          handle[(s - 1) % nb] = redmule_queue_submit(&queue, x, w, z, job.tm, job.tn, job.tk,
+                                                      op, args->fmt);
+      }
+      if (s >= 2 && s - 2 < num_jobs) {
+        redmule_gemm_job_t job = redmule_gemm_job(args, blk, tile_m, tile_n, tile_k, s - 2);
+        if (job.tm && job.tk) redmule_queue_wait(&queue, handle[(s - 2) % nb]);
+      }
+    }
+
+    // Tiles written by other clusters must be complete, and buffers free in
+    // all of them, before the next step
+    if (blk->comm)
+      pb_global_barrier(blk->comm);
+    else
+      snrt_cluster_hw_barrier();
+  }
+
+  if (driver) redmule_queue_deinit(&queue);
+
+  snrt_l1_update_next_v2(heap);
+}
+
+/**
+ * @brief Compute a GEMM of any size on the cluster's RedMulE.
+ *
+ * Must be called by all cores of the cluster. The first compute core drives
+ * RedMulE and the DM core moves the tiles, the other cores only
+ * synchronize. The tile buffers are allocated in TCDM and released on
+ * return.
+ *
+ * @return 0 on success, non-zero if the GEMM is not supported, in which case
+ *         nothing is computed
+ */
+static inline int redmule_gemm(const redmule_gemm_args_t *args) {
+  uint32_t tile_m, tile_n, tile_k;
+  redmule_gemm_tile_sizes(args, &tile_m, &tile_n, &tile_k);
+  if (redmule_gemm_check(args, tile_n, tile_k)) return 1;
+
+  redmule_gemm_block_t blk = {0};
+  blk.m = args->m;
+  blk.k = args->k;
+  blk.load_x = 1;
+  blk.load_w = 1;
+  redmule_gemm_block(args, &blk);
+  return 0;
+}
+
+// Get the cluster of a set closest to the memory tile holding an address,
+// or the first cluster of the set if the address is not in a memory tile
+static inline uint32_t redmule_gemm_leader(const void *ptr, uint32_t clusters) {
+  uintptr_t addr = (uintptr_t)ptr;
+  uint32_t leader = __builtin_ctz(clusters);
+  if (addr < PICOBELLO_ADDRMAP_L2_SPM_0_BASE_ADDR ||
+      addr >= PICOBELLO_ADDRMAP_L2_SPM_0_BASE_ADDR + PB_NUM_MEM_TILES * PICOBELLO_ADDRMAP_L2_SPM_0_SIZE)
+    return leader;
+  uint32_t tile = (addr - PICOBELLO_ADDRMAP_L2_SPM_0_BASE_ADDR) / PICOBELLO_ADDRMAP_L2_SPM_0_SIZE;
+  uint32_t leader_hops = UINT32_MAX;
+  for (uint32_t c = 0; c < snrt_cluster_num(); c++) {
+    if (!((clusters >> c) & 1)) continue;
+    uint32_t hops = pb_mem_tile_hops(c, tile);
+    if (hops < leader_hops) {
+      leader = c;
+      leader_hops = hops;
+    }
+  }
+  return leader;
+}
+
+/**
+ * @brief Compute a GEMM of any size on the RedMulE of all clusters.
+ *
+ * Z is split into a grid of blocks matching the cluster mesh: mesh rows
+ * split M and mesh columns split K. All clusters of a mesh row need the
+ * same X tiles, and all clusters of a mesh column the same W tiles. Every
+ * tile is therefore loaded from L2 only once, by the cluster of the row
+ * (column) closest to the memory tile holding the rows of X (columns of W)
+ * of the block, and multicast to the rest of the row (column). Placing the
+ * operands in the memory tiles next to the clusters that use them, e.g.
+ * with pb_l2_alloc_near(), keeps the L2 traffic local.
+ *
+ * Must be called by all cores of all clusters.
+ *
+ * @param args The GEMM arguments, the same in all clusters
+ * @param comm Communicator of all clusters
+ * @return 0 on success, non-zero if the GEMM is not supported, in which case
+ *         nothing is computed
+ */
+static inline int redmule_gemm_parallel(const redmule_gemm_args_t *args, pb_comm_t comm) {
+  uint32_t prec = redmule_fmt_size(args->fmt);
+  uint32_t tile_m, tile_n, tile_k;
+  redmule_gemm_tile_sizes(args, &tile_m, &tile_n, &tile_k);
+  if (redmule_gemm_check(args, tile_n, tile_k)) return 1;
+
+  // Blocks are a multiple of the tile sizes, so that all clusters run the
+  // same number of jobs. Blocks at the edges may be smaller or empty.
+  uint32_t m_tiles = (args->m + tile_m - 1) / tile_m;
+  uint32_t k_tiles = (args->k + tile_k - 1) / tile_k;
+  uint32_t row = pb_cluster_row();
+  uint32_t col = pb_cluster_col();
+  redmule_gemm_block_t blk;
+  blk.m = ((m_tiles + PB_CLUSTER_PER_COL - 1) / PB_CLUSTER_PER_COL) * tile_m;
+  blk.k = ((k_tiles + PB_CLUSTER_PER_ROW - 1) / PB_CLUSTER_PER_ROW) * tile_k;
+  blk.row = row * blk.m;
+  blk.col = col * blk.k;
+
+  // Share the X tiles along the mesh row, and the W tiles down the column
+  uint32_t x_leader = redmule_gemm_leader(
+      (const char *)args->x + blk.row * args->ldx * prec, pb_cluster_row_set(row));
+  uint32_t w_leader =
+      redmule_gemm_leader((const char *)args->w + blk.col * prec, pb_cluster_col_set(col));
+  blk.load_x = blk.mcast_x = snrt_cluster_idx() == x_leader;
+  blk.load_w = blk.mcast_w = snrt_cluster_idx() == w_leader;
+  blk.x_mcast = pb_mcast_row(row);
+  blk.w_mcast = pb_mcast_col(col);
+  blk.comm = comm;
+
+  redmule_gemm_block(args, &blk);
+  return 0;
+}
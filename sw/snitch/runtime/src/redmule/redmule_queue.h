@@ -0,0 +1,151 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+/**
+ * @file
+ * @brief Asynchronous job queue for the cluster's RedMulE.
+ *
+ * RedMulE holds REDMULE_NUM_CONTEXTS job contexts: while a job runs, the
+ * next one can already be acquired, programmed and triggered, such that
+ * RedMulE starts it as soon as the running job completes. Jobs are
+ * submitted with redmule_queue_submit(), which returns a handle to be
+ * polled with redmule_queue_done() or waited on with redmule_queue_wait().
+ * Waiting cores sleep until the RedMulE event interrupt signals the
+ * completion of a job.
+ *
+ * A queue must only be used by a single core of the cluster.
+ */
+
+// Handle of a submitted job, counting the jobs submitted to the queue
+typedef uint32_t redmule_job_t;
+
+typedef struct {
+  // RedMulE job IDs of the jobs in flight, in submission order
+  int job_id[REDMULE_NUM_CONTEXTS];
+  // Number of jobs submitted to and completed by RedMulE
+  uint32_t submitted;
+  uint32_t completed;
+} redmule_queue_t;
+
+/**
+ * @brief Enable RedMulE and initialize an empty queue.
+ */
+static inline void redmule_queue_init(redmule_queue_t *q) {
+  redmule_cg_enable();
+  redmule_soft_clear();
+  q->submitted = 0;
+  q->completed = 0;
+  snrt_interrupt_enable(IRQ_M_ACC);
+}
+
+/**
+ * @brief Update the number of completed jobs.
+ * @return The number of jobs completed since the queue was initialized.
+ *
+ * Jobs run in submission order, so all jobs submitted before the running
+ * one are complete. A job that just completed may still be reported as
+ * running, in which case it is only retired by a later poll.
+ */
+static inline uint32_t redmule_queue_poll(redmule_queue_t *q) {
+  uint32_t in_flight = q->submitted - q->completed;
+  if (!in_flight) return q->completed;
+  if (redmule_get_status() == 0) {
+    q->completed = q->submitted;
+  } else {
+    int running = redmule_get_running_job();
+    for (uint32_t i = 1; i < in_flight; i++) {
+      if (q->job_id[(q->completed + i) % REDMULE_NUM_CONTEXTS] == running) {
+        q->completed += i;
+        break;
+      }
+    }
+  }
+  return q->completed;
+}
+
+/**
+ * @brief Check if a job has completed, without blocking.
+ */
+static inline int redmule_queue_done(redmule_queue_t *q, redmule_job_t job) {
+  return job < redmule_queue_poll(q);
+}
+
+/**
+ * @brief Sleep until a job has completed.
+ *
+ * The event is cleared before polling, such that a job completing after
+ * the poll wakes up the core.
+ */
+static inline void redmule_queue_wait(redmule_queue_t *q, redmule_job_t job) {
+  while (1) {
+    redmule_evt_clear(1 << snrt_cluster_core_idx());
+    if (redmule_queue_done(q, job)) break;
+    snrt_wfi();
+  }
+}
+
+/**
+ * @brief Sleep until all submitted jobs have completed.
+ */
+static inline void redmule_queue_wait_all(redmule_queue_t *q) {
+  if (q->submitted) redmule_queue_wait(q, q->submitted - 1);
+}
+
+// Acquire a job context, waiting for the oldest job in flight to complete if
+// all contexts are in use.
+static inline int redmule_queue_acquire(redmule_queue_t *q) {
+  int job_id;
+  if (q->submitted - q->completed == REDMULE_NUM_CONTEXTS)
+    redmule_queue_wait(q, q->completed);
+  while ((job_id = redmule_acquire_job()) < 0)
+    ;
+  return job_id;
+}
+
+// Trigger the job programmed in an acquired context
+static inline redmule_job_t redmule_queue_trigger(redmule_queue_t *q, int job_id) {
+  redmule_trigger_job();
+  q->job_id[q->submitted % REDMULE_NUM_CONTEXTS] = job_id;
+  return q->submitted++;
+}
+
+/**
+ * @brief Submit a job, see redmule_cfg(). Only blocks while all job contexts
+ *        are in use.
+ * @return The handle of the job.
+ */
+static inline redmule_job_t redmule_queue_submit(redmule_queue_t *q, unsigned int x, unsigned int w,
+                                                 unsigned int z, uint16_t m_size, uint16_t n_size,
+                                                 uint16_t k_size, uint8_t gemm_op, uint8_t gemm_fmt) {
+  int job_id = redmule_queue_acquire(q);
+  redmule_cfg(x, w, z, m_size, n_size, k_size, gemm_op, gemm_fmt);
+  return redmule_queue_trigger(q, job_id);
+}
+
+/**
+ * @brief Submit a job with quantized weights, see redmule_cfg(). Only blocks
+ *        while all job contexts are in use.
+ * @return The handle of the job.
+ */
+static inline redmule_job_t redmule_queue_submit(redmule_queue_t *q, unsigned int x, unsigned int w,
+                                                 unsigned int z, unsigned int g, unsigned int s,
+                                                 unsigned int b, uint16_t m_size, uint16_t n_size,
+                                                 uint16_t k_size, uint8_t gemm_op, uint8_t gemm_fmt,
+                                                 uint8_t dequant_en, uint8_t q_fmt) {
+  int job_id = redmule_queue_acquire(q);
+  redmule_cfg(x, w, z, g, s, b, m_size, n_size, k_size, gemm_op, gemm_fmt, dequant_en, q_fmt);
+  return redmule_queue_trigger(q, job_id);
+}
+
+/**
+ * @brief Wait for all jobs to complete and disable RedMulE.
+ */
+static inline void redmule_queue_deinit(redmule_queue_t *q) {
+  redmule_queue_wait_all(q);
+  redmule_evt_clear(1 << snrt_cluster_core_idx());
+  snrt_interrupt_disable(IRQ_M_ACC);
+  redmule_cg_disable();
+}
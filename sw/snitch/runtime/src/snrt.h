@@ -13,6 +13,8 @@
 #include "snitch_cluster_peripheral_addrmap.h"
 #include "pb_raw_addrmap.h"
 #include "pb_noc_cfg.h"
+#include "pb_cluster_cfg.h"
+#include "pb_l2_cfg.h"
 #define SNRT_TCDM_START_ADDR PICOBELLO_ADDRMAP_CLUSTER_0_TCDM_BASE_ADDR
 
 // TODO: the 40000 stride is hardcoded here, but it would better be
@@ -53,6 +55,9 @@ typedef snitch_cluster__stride40000_t snitch_cluster_t;
 #include "team.h"
 #include "types.h"
 #include "pb_team.h"
+#include "pb_sync.h"
+#include "pb_collectives.h"
+#include "pb_l2_alloc.h"
 
 // Accelerators
 #include "datamover/archi_datamover.h"
@@ -61,3 +66,5 @@ typedef snitch_cluster__stride40000_t snitch_cluster_t;
 #include "redmule/archi_redmule.h"
 #include "redmule/hal_redmule.h"
 #include "redmule/redmule_utils.h"
+#include "redmule/redmule_queue.h"
+#include "redmule/redmule_gemm.h"
@@ -0,0 +1,125 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This code tests the collectives of Picobello communicators. All clusters
+// broadcast, gather and reduce buffers of small integers, which are exactly
+// representable in all precisions, and check the results.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+// Not a multiple of the number of clusters, to test uneven slices
+#define LENGTH 100
+
+#define BCAST_ROOT 5
+
+template <typename T>
+static uint32_t test_allreduce(pb_comm_t comm) {
+    uint32_t n_errs = 0;
+
+    T *buf = (T *)snrt_l1_alloc_cluster_local(LENGTH * sizeof(T), sizeof(T));
+    T *tmp = (T *)snrt_l1_alloc_cluster_local(LENGTH * sizeof(T), sizeof(T));
+    if (snrt_is_dm_core()) {
+        for (uint32_t i = 0; i < LENGTH; i++)
+            buf[i] = (T)((snrt_cluster_idx() + i) % 8);
+    }
+
+    pb_allreduce(buf, tmp, LENGTH, sizeof(T), comm);
+
+    if (snrt_is_dm_core()) {
+        for (uint32_t i = 0; i < LENGTH; i++) {
+            uint32_t expected = 0;
+            for (uint32_t c = 0; c < snrt_cluster_num(); c++)
+                expected += (c + i) % 8;
+            if (buf[i] != (T)expected) n_errs++;
+        }
+    }
+    return n_errs;
+}
+
+static uint32_t test_reduce_scatter(pb_comm_t comm) {
+    uint32_t n_errs = 0;
+
+    double *buf = (double *)snrt_l1_alloc_cluster_local(
+        LENGTH * sizeof(double), sizeof(double));
+    double *tmp = (double *)snrt_l1_alloc_cluster_local(
+        LENGTH * sizeof(double), sizeof(double));
+    if (snrt_is_dm_core()) {
+        for (uint32_t i = 0; i < LENGTH; i++) buf[i] = snrt_cluster_idx() * i;
+    }
+
+    pb_reduce_scatter(buf, tmp, LENGTH, sizeof(double), comm);
+
+    if (snrt_is_dm_core()) {
+        uint32_t offset, slice_len;
+        pb_collective_slice(LENGTH, comm->size, pb_comm_rank(comm), &offset,
+                            &slice_len);
+        uint32_t cidx_sum = snrt_cluster_num() * (snrt_cluster_num() - 1) / 2;
+        for (uint32_t i = offset; i < offset + slice_len; i++) {
+            if (buf[i] != (double)(cidx_sum * i)) n_errs++;
+        }
+    }
+    return n_errs;
+}
+
+static uint32_t test_broadcast(pb_comm_t comm) {
+    uint32_t n_errs = 0;
+
+    uint32_t *buf = (uint32_t *)snrt_l1_alloc_cluster_local(
+        LENGTH * sizeof(uint32_t), sizeof(uint32_t));
+    if (snrt_is_dm_core()) {
+        for (uint32_t i = 0; i < LENGTH; i++)
+            buf[i] = (snrt_cluster_idx() == BCAST_ROOT) ? i : 0;
+    }
+
+    pb_broadcast(buf, LENGTH * sizeof(uint32_t), BCAST_ROOT, comm);
+
+    if (snrt_is_dm_core()) {
+        for (uint32_t i = 0; i < LENGTH; i++) {
+            if (buf[i] != i) n_errs++;
+        }
+    }
+    return n_errs;
+}
+
+static uint32_t test_allgather(pb_comm_t comm) {
+    uint32_t n_errs = 0;
+
+    // One slice of two words per rank, holding the rank and cluster index
+    uint32_t *buf = (uint32_t *)snrt_l1_alloc_cluster_local(
+        comm->size * 2 * sizeof(uint32_t), sizeof(uint32_t));
+    uint8_t ring[PB_COMM_MAX_CLUSTERS];
+    uint32_t rank = pb_comm_ring(comm, ring);
+    if (snrt_is_dm_core()) {
+        buf[2 * rank] = rank;
+        buf[2 * rank + 1] = snrt_cluster_idx();
+    }
+
+    pb_allgather(buf, 2 * sizeof(uint32_t), comm);
+
+    if (snrt_is_dm_core()) {
+        for (uint32_t r = 0; r < comm->size; r++) {
+            if (buf[2 * r] != r || buf[2 * r + 1] != ring[r]) n_errs++;
+        }
+    }
+    return n_errs;
+}
+
+int main() {
+    uint32_t n_errs = 0;
+
+    pb_comm_t comm;
+    pb_comm_create((uint32_t)((1ull << snrt_cluster_num()) - 1),
+                   PB_BARRIER_HIERARCHICAL, &comm);
+
+    n_errs += test_broadcast(comm);
+    n_errs += test_allgather(comm);
+    n_errs += test_reduce_scatter(comm);
+    n_errs += test_allreduce<double>(comm);
+    n_errs += test_allreduce<float>(comm);
+    n_errs += test_allreduce<__fp16>(comm);
+
+    return n_errs;
+}
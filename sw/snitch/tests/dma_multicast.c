@@ -24,46 +24,34 @@
 #define N_CLUSTERS_TO_USE snrt_cluster_num()
 #endif
 
-// TODO(lleone): Check if is okay to shift by 18. Probably you need to adapt it to picobello
-#define BCAST_MASK_ACTIVE ((N_CLUSTERS_TO_USE - 1) << 18)
-// #define BCAST_MASK_ALL ((snrt_cluster_num() - 1) << 18)
-
-
 static inline void dma_broadcast_to_clusters(void* dst, void* src, size_t size) {
-    // snrt_enable_multicast(BCAST_MASK_ACTIVE);
     if (snrt_is_dm_core() && (snrt_cluster_idx() == 0)) {
-        snrt_dma_start_1d_mcast(snrt_remote_l1_ptr(dst, 0, 1), src, size, BCAST_MASK_ACTIVE);
+        // Reach the active clusters with as few multicast transactions as
+        // possible, also when their number is not a power of two
+        pb_mcast_t mcasts[32];
+        uint32_t active = (uint32_t)((1ull << N_CLUSTERS_TO_USE) - 1);
+        uint32_t num_mcasts = pb_mcast_decompose(active, mcasts);
+        for (uint32_t i = 0; i < num_mcasts; i++) {
+            snrt_dma_start_1d_mcast(pb_mcast_addr(dst, mcasts[i]), src, size,
+                                    mcasts[i].mask);
+        }
         snrt_dma_wait_all();
     }
-    // snrt_disable_multicast();
-}
-
-static inline int cluster_participates_in_bcast(int i) {
-    return (i < N_CLUSTERS_TO_USE);
 }
 
-static inline void broadcast_wrapper(void* dst, void* src, size_t size) {
-    snrt_global_barrier();
+static inline void broadcast_wrapper(void* dst, void* src, size_t size,
+                                     pb_comm_t comm) {
+    // Only the participating clusters synchronize, so that the others don't
+    // interfere with them by sending atomics on the narrow interconnect
+    pb_global_barrier(comm);
     dma_broadcast_to_clusters(dst, src, size);
-    // Put clusters who don't participate in the broadcast to sleep, as if
-    // they proceed directly to the global barrier, they will interfere with
-    // the other clusters, by sending their atomics on the narrow interconnect.
-    if (!cluster_participates_in_bcast(snrt_cluster_idx())) {
-        snrt_wfi();
-        snrt_int_clr_mcip();
-    }
-    // Wake these up when cluster 0 is done
-    else if ((snrt_cluster_idx() == 0) && snrt_is_dm_core()) {
-        for (int i = 0; i < snrt_cluster_num(); i++) {
-            if (!cluster_participates_in_bcast(i))
-                snrt_cluster()->peripheral_reg.cl_clint_set.f.cl_clint_set = 0x1ff;
-        }
-    }
 }
 
 int main() {
-    snrt_interrupt_enable(IRQ_M_CLUSTER);
-    // snrt_int_clr_mcip();
+    // Communicator of the clusters participating in the broadcast
+    pb_comm_t comm;
+    pb_comm_create((uint32_t)((1ull << N_CLUSTERS_TO_USE) - 1),
+                   PB_BARRIER_HIERARCHICAL, &comm);
 
     // Allocate destination buffer
     uint32_t *buffer_dst = (uint32_t *)snrt_l1_next_v2();
@@ -79,12 +67,13 @@ int main() {
 
     // Initiate DMA transfer (twice to preheat the cache)
     for (volatile int i = 0; i < 2; i++) {
-        broadcast_wrapper(buffer_dst, buffer_src, LENGTH * sizeof(uint32_t));
+        broadcast_wrapper(buffer_dst, buffer_src, LENGTH * sizeof(uint32_t),
+                          comm);
     }
 
-    // All other clusters wait on a global barrier to signal the transfer
-    // completion.
-    snrt_global_barrier();
+    // All other participating clusters wait on a barrier to signal the
+    // transfer completion.
+    pb_global_barrier(comm);
 
     // Every cluster except cluster 0 checks that the data in the destination
     // buffer is correct. To speed this up we only check the first 32 elements.
@@ -0,0 +1,119 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This code tests the L2 allocator. Every cluster allocates a buffer close
+// to it, and checks that the buffer is placed in the closest memory tile
+// with a heap and is not overwritten by the other clusters. Cluster 0 also
+// allocates a buffer interleaved across the memory tiles, in software and in
+// the interleaved L2 window.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+#define LENGTH 256
+#define CHUNK_SIZE 256
+
+static inline uint32_t tile_idx(void *ptr) {
+    return ((uintptr_t)ptr - PICOBELLO_ADDRMAP_L2_SPM_0_BASE_ADDR) /
+           PICOBELLO_ADDRMAP_L2_SPM_0_SIZE;
+}
+
+static inline uint32_t has_heap(uint32_t tile) {
+    uintptr_t start, end;
+    pb_l2_heap_bounds(tile, &start, &end);
+    return start != end;
+}
+
+static uint32_t test_near(uint32_t *buf) {
+    uint32_t n_errs = 0;
+
+    if (!buf || ((uintptr_t)buf % PB_L2_ALLOC_ALIGN)) return 1;
+
+    // No tile with a heap may be closer
+    uint32_t hops = pb_mem_tile_hops(snrt_cluster_idx(), tile_idx(buf));
+    for (uint32_t t = 0; t < PB_NUM_MEM_TILES; t++) {
+        if (has_heap(t) && pb_mem_tile_hops(snrt_cluster_idx(), t) < hops)
+            n_errs++;
+    }
+
+    for (uint32_t i = 0; i < LENGTH; i++) {
+        if (buf[i] != snrt_cluster_idx() * LENGTH + i) n_errs++;
+    }
+    return n_errs;
+}
+
+static uint32_t test_interleaved() {
+    uint32_t n_errs = 0;
+    uint32_t len = PB_NUM_MEM_TILES * CHUNK_SIZE;
+
+    pb_l2_interleaved_t buf;
+    if (pb_l2_alloc_interleaved(len * sizeof(uint32_t), CHUNK_SIZE, &buf))
+        return 1;
+
+    for (uint32_t i = 0; i < len; i++)
+        *(uint32_t *)pb_l2_interleaved_ptr(&buf, i * sizeof(uint32_t)) = i;
+
+    uint32_t prev_tile = PB_NUM_MEM_TILES;
+    for (uint32_t i = 0; i < len; i++) {
+        uint32_t *ptr =
+            (uint32_t *)pb_l2_interleaved_ptr(&buf, i * sizeof(uint32_t));
+        if (*ptr != i) n_errs++;
+        // Consecutive chunks are in different tiles
+        uint32_t tile = tile_idx(ptr);
+        if ((i * sizeof(uint32_t)) % CHUNK_SIZE == 0 && tile == prev_tile)
+            n_errs++;
+        prev_tile = tile;
+    }
+    return n_errs;
+}
+
+static uint32_t test_window() {
+    uint32_t n_errs = 0;
+    uint32_t len = 2 * PB_NUM_MEM_TILES * PB_L2_INTERLEAVE_BLOCK_SIZE /
+                   sizeof(uint32_t);
+
+    uint32_t *buf = (uint32_t *)pb_l2_alloc_window(len * sizeof(uint32_t));
+    if (!buf) return 1;
+
+    for (uint32_t i = 0; i < len; i++) buf[i] = i;
+
+    // Consecutive blocks are in consecutive tiles, outside of the heaps
+    for (uint32_t i = 0; i < len; i++) {
+        uint32_t *ptr = (uint32_t *)pb_l2_window_tile_ptr(&buf[i]);
+        if (*ptr != i) n_errs++;
+        uint32_t block = (uintptr_t)&buf[i] / PB_L2_INTERLEAVE_BLOCK_SIZE;
+        if (tile_idx(ptr) != block % PB_NUM_MEM_TILES) n_errs++;
+        uintptr_t start, end;
+        pb_l2_heap_bounds(tile_idx(ptr), &start, &end);
+        if ((uintptr_t)ptr < end) n_errs++;
+    }
+    return n_errs;
+}
+
+int main() {
+    uint32_t n_errs = 0;
+    uint32_t *buf = NULL;
+
+    if (snrt_is_dm_core()) {
+        buf = (uint32_t *)pb_l2_alloc_near(LENGTH * sizeof(uint32_t));
+        for (uint32_t i = 0; buf && i < LENGTH; i++)
+            buf[i] = snrt_cluster_idx() * LENGTH + i;
+    }
+
+    // All clusters allocate and write their buffer before checking it
+    snrt_global_barrier();
+
+    if (snrt_is_dm_core()) {
+        n_errs += test_near(buf);
+        if (snrt_cluster_idx() == 0) {
+            n_errs += test_interleaved();
+#if PB_L2_INTERLEAVE_ENABLE
+            n_errs += test_window();
+#endif
+        }
+    }
+
+    return n_errs;
+}
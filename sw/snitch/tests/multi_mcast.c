@@ -16,8 +16,6 @@
 #include "snrt.h"
 
 /* Parameters */
-#define ROW_MASK 0x00300000
-#define COLUMN_MASK 0x000C0000
 #define TESTVAL 0xABCD
 
 
@@ -62,8 +60,8 @@ void send_mcast(uint32_t* dst, uint32_t mask){
 /* Main Function */
 int main(){
   uint32_t* mcast_dst   = (uint32_t*)(snrt_cluster()->tcdm.mem);
-  uint32_t  row_mask    = ROW_MASK;
-  uint32_t  column_mask = COLUMN_MASK;
+  uint32_t  row_mask    = pb_mcast_row(0).mask;
+  uint32_t  column_mask = pb_mcast_col(0).mask;
 
   snrt_global_barrier();
   if (snrt_cluster_core_idx() == 0){
@@ -0,0 +1,71 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This code tests the barriers of Picobello communicators, with both the
+// centralized and the hierarchical algorithm, over all clusters, over a
+// subset of clusters with an irregular shape, and over disjoint partitions
+// of the mesh synchronizing concurrently. Before every barrier, all members
+// increment a counter in the TCDM of the communicator root. After the
+// barrier, the counter must reflect the arrivals of all members.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+#define NUM_ITERATIONS 8
+
+// Clusters may pass different members, one set per partition
+static uint32_t test_barrier(uint32_t members, pb_barrier_algo_t algo) {
+    uint32_t n_errs = 0;
+
+    volatile uint32_t *counter = (volatile uint32_t *)
+        snrt_l1_alloc_cluster_local(sizeof(uint32_t), sizeof(uint32_t));
+    if (snrt_is_dm_core()) *counter = 0;
+
+    pb_comm_t comm;
+    pb_comm_create(members, algo, &comm);
+
+    if (comm->is_participant && snrt_is_dm_core()) {
+        volatile uint32_t *root_counter =
+            (volatile uint32_t *)snrt_remote_l1_ptr(
+                (void *)counter, snrt_cluster_idx(), comm->root);
+        for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+            __atomic_add_fetch(root_counter, 1, __ATOMIC_RELAXED);
+            pb_inter_cluster_barrier(comm);
+            // Faster members may already have arrived at the next barrier
+            if (*root_counter < (i + 1) * comm->size) n_errs++;
+        }
+    }
+
+    // Also synchronize the compute cores, and the non-members
+    pb_global_barrier(comm);
+    snrt_global_barrier();
+    return n_errs;
+}
+
+// Partition the mesh into its rows, and into 2x2 quadrants
+static uint32_t row_partition() { return pb_cluster_row_set(pb_cluster_row()); }
+
+static uint32_t quad_partition() {
+    return pb_cluster_rect(pb_cluster_col() & ~1u, pb_cluster_row() & ~1u, 2,
+                           2);
+}
+
+int main() {
+    uint32_t n_errs = 0;
+
+    // All clusters, and the clusters of an L-shaped region, so that rows
+    // have a different number of members
+    uint32_t all = (uint32_t)((1ull << snrt_cluster_num()) - 1);
+    uint32_t subset = all & 0x013f;
+
+    n_errs += test_barrier(all, PB_BARRIER_CENTRALIZED);
+    n_errs += test_barrier(all, PB_BARRIER_HIERARCHICAL);
+    n_errs += test_barrier(subset, PB_BARRIER_CENTRALIZED);
+    n_errs += test_barrier(subset, PB_BARRIER_HIERARCHICAL);
+    n_errs += test_barrier(row_partition(), PB_BARRIER_CENTRALIZED);
+    n_errs += test_barrier(quad_partition(), PB_BARRIER_HIERARCHICAL);
+
+    return n_errs;
+}
@@ -0,0 +1,61 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test computes a GEMM with the tiled RedMulE GEMM, streaming the
+// operands from L2. The tiles are smaller than the matrices, and ragged
+// along the reduction dimension, such that the output tiles accumulate the
+// result of multiple jobs. The GEMM is run once with a separate Y and once
+// accumulating in place into Z.
+
+#include <stdint.h>
+
+#include "pb_addrmap.h"
+
+#include "snrt.h"
+#include "data/redmule_tensors.h"
+
+uint16_t z_out[M_SIZE * K_SIZE] __attribute__ ((aligned(64)));
+uint16_t z_inplace[M_SIZE * K_SIZE] __attribute__ ((aligned(64)));
+
+int main() {
+
+  if (snrt_cluster_idx() > 0) return 0;
+
+  uint32_t errors = 0;
+
+  redmule_gemm_args_t args = {0};
+  args.x = x_inp;
+  args.w = w_inp;
+  args.y = y_inp;
+  args.z = z_out;
+  args.m = M_SIZE;
+  args.n = N_SIZE;
+  args.k = K_SIZE;
+  args.ldx = N_SIZE;
+  args.ldw = K_SIZE;
+  args.ldz = K_SIZE;
+  args.fmt = REDMULE_Float16;
+  args.tile_m = 16;
+  args.tile_n = 24;
+  args.tile_k = 16;
+  redmule_gemm(&args);
+
+  // Accumulate in place into Z, initialized with Y
+  if (snrt_is_dm_core()) {
+    snrt_dma_start_1d(z_inplace, y_inp, sizeof(z_inplace));
+    snrt_dma_wait_all();
+  }
+  snrt_cluster_hw_barrier();
+  args.y = z_inplace;
+  args.z = z_inplace;
+  redmule_gemm(&args);
+
+  // Check computation is correct
+  if (snrt_global_core_idx() == 0) {
+    errors += redmule16_compare_int((uint32_t*)z_out, golden, M_SIZE*K_SIZE/2);
+    errors += redmule16_compare_int((uint32_t*)z_inplace, golden, M_SIZE*K_SIZE/2);
+  }
+
+  return errors;
+}
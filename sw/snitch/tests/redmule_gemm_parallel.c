@@ -0,0 +1,50 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test computes a GEMM on the RedMulE of all clusters. Every cluster
+// computes a block of the result, receiving the X and W tiles it shares
+// with the other clusters of its mesh row and column by multicast.
+
+#include <stdint.h>
+
+#include "pb_addrmap.h"
+
+#include "snrt.h"
+#include "data/redmule_tensors.h"
+
+uint16_t z_out[M_SIZE * K_SIZE] __attribute__ ((aligned(64)));
+
+int main() {
+
+  uint32_t errors = 0;
+
+  pb_comm_t comm;
+  pb_comm_create((1u << snrt_cluster_num()) - 1, PB_BARRIER_HIERARCHICAL, &comm);
+
+  redmule_gemm_args_t args = {0};
+  args.x = x_inp;
+  args.w = w_inp;
+  args.y = y_inp;
+  args.z = z_out;
+  args.m = M_SIZE;
+  args.n = N_SIZE;
+  args.k = K_SIZE;
+  args.ldx = N_SIZE;
+  args.ldw = K_SIZE;
+  args.ldz = K_SIZE;
+  args.fmt = REDMULE_Float16;
+  // Every cluster computes an 8x8 block of Z with two jobs
+  args.tile_m = 8;
+  args.tile_n = 16;
+  args.tile_k = 8;
+  redmule_gemm_parallel(&args, comm);
+
+  pb_global_barrier(comm);
+
+  // Check computation is correct
+  if (snrt_global_core_idx() == 0)
+    errors += redmule16_compare_int((uint32_t*)z_out, golden, M_SIZE*K_SIZE/2);
+
+  return errors;
+}
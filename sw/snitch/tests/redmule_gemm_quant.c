@@ -0,0 +1,57 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test computes a GEMM with quantized weights with the tiled RedMulE
+// GEMM. W consists of a single tile, streamed from L2 in its packed form
+// once for every tile of Z along M, and dequantized by RedMulE.
+
+#include <stdint.h>
+
+#include "pb_addrmap.h"
+
+#include "snrt.h"
+#include "data/redmule_tensors_quant.h"
+
+uint16_t z_out[M_SIZE * K_SIZE] __attribute__ ((aligned(64)));
+
+int main() {
+
+  if (snrt_cluster_idx() > 0) return 0;
+
+  uint32_t errors = 0;
+
+  // Sizes of the W, G, S and B parts of the tile, as in redmule_quant.c
+  redmule_gemm_quant_t quant = {0};
+  quant.q_fmt = quant_fmt;
+  quant.g = g_inp;
+  quant.s = s_inp;
+  quant.b = b_inp;
+  quant.w_tile_size = N_SIZE * K_SIZE * sizeof(uint8_t);
+  quant.g_tile_size = M_SIZE * sizeof(uint16_t);
+  quant.s_tile_size = M_SIZE * 32 * sizeof(uint16_t);
+  quant.b_tile_size = M_SIZE * 32 * sizeof(uint8_t);
+
+  redmule_gemm_args_t args = {0};
+  args.x = x_inp;
+  args.w = w_inp;
+  args.y = y_inp;
+  args.z = z_out;
+  args.m = M_SIZE;
+  args.n = N_SIZE;
+  args.k = K_SIZE;
+  args.ldx = N_SIZE;
+  args.ldz = K_SIZE;
+  args.fmt = REDMULE_Float16;
+  args.tile_m = M_SIZE / 2;
+  args.tile_n = N_SIZE;
+  args.tile_k = K_SIZE;
+  args.quant = &quant;
+  redmule_gemm(&args);
+
+  // Check computation is correct
+  if (snrt_global_core_idx() == 0)
+    errors = redmule16_compare_int((uint32_t*)z_out, golden, M_SIZE*K_SIZE/2);
+
+  return errors;
+}
@@ -0,0 +1,124 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test computes a GEMM with quantized weights with the tiled RedMulE
+// GEMM, W consisting of 2x2 pre-tiled tiles along N and K. It runs on a
+// single cluster, and on all clusters where the packed W tiles are
+// multicast down the mesh columns. A GEMM whose tiles don't divide W is
+// rejected.
+//
+// The tiles of the first tile row of W hold the quantized W of the test
+// data, while the others are zero. X holds the X of the test data followed
+// by zeros, and Y the Y of the test data twice, such that both halves of Z
+// match the golden result.
+
+#include <stdint.h>
+
+#include "pb_addrmap.h"
+
+#include "snrt.h"
+#include "data/redmule_tensors_quant.h"
+
+// Number of W tiles along N and K
+#define N_TILES 2
+#define K_TILES 2
+#define TILED_N (N_TILES * N_SIZE)
+#define TILED_K (K_TILES * K_SIZE)
+
+// Sizes of the W, G, S and B parts of a tile, as in redmule_quant.c
+#define W_TILE_SIZE (N_SIZE * K_SIZE * sizeof(uint8_t))
+#define G_TILE_SIZE (M_SIZE * sizeof(uint16_t))
+#define S_TILE_SIZE (M_SIZE * 32 * sizeof(uint16_t))
+#define B_TILE_SIZE (M_SIZE * 32 * sizeof(uint8_t))
+
+uint16_t x_tiled[M_SIZE * TILED_N] __attribute__ ((aligned(64)));
+uint8_t w_tiled[N_TILES * K_TILES * W_TILE_SIZE] __attribute__ ((aligned(64)));
+uint8_t g_tiled[N_TILES * K_TILES * G_TILE_SIZE] __attribute__ ((aligned(64)));
+uint8_t s_tiled[N_TILES * K_TILES * S_TILE_SIZE] __attribute__ ((aligned(64)));
+uint8_t b_tiled[N_TILES * K_TILES * B_TILE_SIZE] __attribute__ ((aligned(64)));
+uint16_t y_tiled[M_SIZE * TILED_K] __attribute__ ((aligned(64)));
+uint16_t z_out[M_SIZE * TILED_K] __attribute__ ((aligned(64)));
+uint16_t z_parallel[M_SIZE * TILED_K] __attribute__ ((aligned(64)));
+
+// Compare both halves of Z against the golden result
+static uint32_t check(uint16_t *z) {
+  uint32_t errors = 0;
+  for (uint32_t row = 0; row < M_SIZE; row++) {
+    for (uint32_t j = 0; j < K_TILES; j++)
+      errors += redmule16_compare_int((uint32_t*)&z[row * TILED_K + j * K_SIZE],
+                                      &golden[row * K_SIZE / 2], K_SIZE / 2);
+  }
+  return errors;
+}
+
+int main() {
+
+  uint32_t errors = 0;
+
+  pb_comm_t comm;
+  pb_comm_create((1u << snrt_cluster_num()) - 1, PB_BARRIER_HIERARCHICAL, &comm);
+
+  // Lay out the operands, W tiles being indexed by col * N_TILES + row
+  if (snrt_cluster_idx() == 0 && snrt_is_dm_core()) {
+    snrt_dma_start_2d(x_tiled, x_inp, N_SIZE * sizeof(uint16_t), TILED_N * sizeof(uint16_t),
+                      N_SIZE * sizeof(uint16_t), M_SIZE);
+    for (uint32_t j = 0; j < K_TILES; j++) {
+      uint32_t tile = j * N_TILES;
+      snrt_dma_start_1d(&w_tiled[tile * W_TILE_SIZE], w_inp, W_TILE_SIZE);
+      snrt_dma_start_1d(&g_tiled[tile * G_TILE_SIZE], g_inp, G_TILE_SIZE);
+      snrt_dma_start_1d(&s_tiled[tile * S_TILE_SIZE], s_inp, S_TILE_SIZE);
+      snrt_dma_start_1d(&b_tiled[tile * B_TILE_SIZE], b_inp, B_TILE_SIZE);
+      snrt_dma_start_2d(&y_tiled[j * K_SIZE], y_inp, K_SIZE * sizeof(uint16_t),
+                        TILED_K * sizeof(uint16_t), K_SIZE * sizeof(uint16_t), M_SIZE);
+    }
+    snrt_dma_wait_all();
+  }
+  pb_global_barrier(comm);
+
+  redmule_gemm_quant_t quant = {0};
+  quant.q_fmt = quant_fmt;
+  quant.g = g_tiled;
+  quant.s = s_tiled;
+  quant.b = b_tiled;
+  quant.w_tile_size = W_TILE_SIZE;
+  quant.g_tile_size = G_TILE_SIZE;
+  quant.s_tile_size = S_TILE_SIZE;
+  quant.b_tile_size = B_TILE_SIZE;
+
+  redmule_gemm_args_t args = {0};
+  args.x = x_tiled;
+  args.w = w_tiled;
+  args.y = y_tiled;
+  args.z = z_out;
+  args.m = M_SIZE;
+  args.n = TILED_N;
+  args.k = TILED_K;
+  args.ldx = TILED_N;
+  args.ldz = TILED_K;
+  args.fmt = REDMULE_Float16;
+  args.tile_m = M_SIZE / 2;
+  args.tile_n = N_SIZE;
+  args.tile_k = K_SIZE;
+  args.quant = &quant;
+  if (snrt_cluster_idx() == 0) errors += redmule_gemm(&args);
+  pb_global_barrier(comm);
+
+  // Every cluster of the first two mesh columns computes a block of Z
+  args.z = z_parallel;
+  args.tile_m = M_SIZE / PB_CLUSTER_PER_COL;
+  errors += redmule_gemm_parallel(&args, comm);
+  pb_global_barrier(comm);
+
+  // Tiles which don't match the pre-tiled W are rejected
+  args.tile_n = 24;
+  if (snrt_cluster_idx() == 0 && !redmule_gemm(&args)) errors++;
+
+  // Check computation is correct
+  if (snrt_global_core_idx() == 0) {
+    errors += check(z_out);
+    errors += check(z_parallel);
+  }
+
+  return errors;
+}
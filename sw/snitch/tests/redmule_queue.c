@@ -0,0 +1,82 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test submits several GEMM jobs back-to-back to RedMulE through the
+// asynchronous job queue, each accumulating into its own copy of Y, and
+// checks the result of every job.
+
+#include <stdint.h>
+
+#include "pb_addrmap.h"
+
+#include "snrt.h"
+#include "data/redmule_tensors.h"
+
+#define NUM_JOBS 4
+
+uint16_t *local_x;
+uint16_t *local_w;
+uint16_t *local_y[NUM_JOBS];
+uint32_t *local_z;
+
+int main() {
+
+  if (snrt_cluster_idx() > 0) return 0;
+
+  uint32_t errors = 0;
+
+  uint32_t core_idx = snrt_global_core_idx();
+
+  uint16_t x_size = M_SIZE * N_SIZE * sizeof(uint16_t);
+  uint16_t w_size = N_SIZE * K_SIZE * sizeof(uint16_t);
+  uint16_t y_size = M_SIZE * K_SIZE * sizeof(uint16_t);
+
+  // Allocate space in TCDM and copy inputs to TCDM
+  if (snrt_is_dm_core()) {
+    local_x = (uint16_t *) snrt_l1_alloc_cluster_local(x_size, 64);
+    local_w = (uint16_t *) snrt_l1_alloc_cluster_local(w_size, 64);
+    local_z = (uint32_t *) snrt_l1_alloc_cluster_local(y_size, 64);
+    snrt_dma_start_1d(local_x, x_inp, x_size);
+    snrt_dma_start_1d(local_w, w_inp, w_size);
+    snrt_dma_start_1d(local_z, golden, y_size);
+    for (int i = 0; i < NUM_JOBS; i++) {
+      local_y[i] = (uint16_t *) snrt_l1_alloc_cluster_local(y_size, 64);
+      snrt_dma_start_1d(local_y[i], y_inp, y_size);
+    }
+    snrt_dma_wait_all();
+  }
+
+  snrt_cluster_hw_barrier();
+
+  if (core_idx == 0) {
+    redmule_queue_t queue;
+    redmule_job_t job[NUM_JOBS];
+
+    redmule_queue_init(&queue);
+
+    // Submit all jobs, only blocking while all job contexts are in use
+    for (int i = 0; i < NUM_JOBS; i++) {
+      job[i] = redmule_queue_submit(&queue,
+                                    (unsigned int) local_x,
+                                    (unsigned int) local_w,
+                                    (unsigned int) local_y[i],
+                                    M_SIZE, N_SIZE, K_SIZE,
+                                    (uint8_t) REDMULE_GEMM,
+                                    (uint8_t) REDMULE_Float16);
+    }
+
+    // Check every job as soon as it completes
+    for (int i = 0; i < NUM_JOBS; i++) {
+      redmule_queue_wait(&queue, job[i]);
+      errors += redmule16_compare_int((uint32_t*)local_y[i], local_z, M_SIZE*K_SIZE/2);
+    }
+
+    // Completed jobs remain completed
+    for (int i = 0; i < NUM_JOBS; i++) errors += !redmule_queue_done(&queue, job[i]);
+
+    redmule_queue_deinit(&queue);
+  }
+
+  return errors;
+}
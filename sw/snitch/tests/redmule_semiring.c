@@ -0,0 +1,90 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test computes all-pairs shortest paths with the tiled RedMulE GEMM,
+// using the REDMULE_ADDMIN semiring. Squaring the distance matrix D in the
+// (min, +) semiring, as min(D, D + D), doubles the length of the paths it
+// accounts for, such that log2(N) squarings give all shortest paths. The
+// result is checked against the Floyd-Warshall algorithm. A semiring product
+// without Y is rejected.
+
+#include <stdint.h>
+
+#include "pb_addrmap.h"
+
+#include "snrt.h"
+
+#define N_NODES 32
+#define LOG2_N_NODES 5
+#define INF 0x7fff
+
+__fp16 dist[2][N_NODES * N_NODES] __attribute__ ((aligned(64)));
+
+int ref[N_NODES * N_NODES];
+
+// Small integer weights, such that all distances are exact in FP16
+static int edge(int i, int j) {
+  if (i == j) return 0;
+  if (j == (i + 1) % N_NODES) return 4;
+  if (j == (i + 5) % N_NODES) return 9;
+  if (j == (i * 7 + 3) % N_NODES) return 1 + i % 3;
+  return INF;
+}
+
+int main() {
+
+  if (snrt_cluster_idx() > 0) return 0;
+
+  uint32_t errors = 0;
+
+  if (snrt_cluster_core_idx() == 0) {
+    for (int i = 0; i < N_NODES; i++) {
+      for (int j = 0; j < N_NODES; j++) {
+        int w = edge(i, j);
+        ref[i * N_NODES + j] = w;
+        dist[0][i * N_NODES + j] = w == INF ? (__fp16)__builtin_inff() : (__fp16)w;
+      }
+    }
+  }
+  snrt_cluster_hw_barrier();
+
+  // Tiles are smaller than the matrix, such that every output tile
+  // accumulates the result of multiple jobs
+  redmule_gemm_args_t args = {0};
+  args.m = N_NODES;
+  args.n = N_NODES;
+  args.k = N_NODES;
+  args.ldx = N_NODES;
+  args.ldw = N_NODES;
+  args.ldz = N_NODES;
+  args.fmt = REDMULE_Float16;
+  args.op = REDMULE_ADDMIN;
+  args.tile_m = 16;
+  args.tile_n = 16;
+  args.tile_k = 16;
+  for (int i = 0; i < LOG2_N_NODES; i++) {
+    args.x = dist[i % 2];
+    args.w = dist[i % 2];
+    args.y = dist[i % 2];
+    args.z = dist[(i + 1) % 2];
+    redmule_gemm(&args);
+  }
+
+  // The semirings have no identity element to start from without Y
+  args.y = NULL;
+  if (!redmule_gemm(&args)) errors++;
+
+  // Check computation is correct
+  if (snrt_cluster_core_idx() == 0) {
+    for (int k = 0; k < N_NODES; k++)
+      for (int i = 0; i < N_NODES; i++)
+        for (int j = 0; j < N_NODES; j++)
+          if (ref[i * N_NODES + k] + ref[k * N_NODES + j] < ref[i * N_NODES + j])
+            ref[i * N_NODES + j] = ref[i * N_NODES + k] + ref[k * N_NODES + j];
+    for (int i = 0; i < N_NODES * N_NODES; i++)
+      errors += (int)dist[LOG2_N_NODES % 2][i] != ref[i];
+  }
+
+  return errors;
+}
@@ -13,8 +13,6 @@
 #include "snrt.h"
 
 /* Parameters */
-#define ROW_MASK    0x00300000
-#define COLUMN_MASK 0x000C0000
 #define ROW_INIT    0x9999
 #define COLUMN_INIT 0xEEEE
 #define TESTVAL     0xABCD
@@ -37,22 +35,21 @@ static inline void dma_broadcast_to_clusters(void* dst, void* src, size_t size,
     }
 }
 
-void issue_dma_mcast(uint32_t *buffer_src, uint32_t *buffer_dst, uint32_t cluster_offset, uint32_t mcast_mask) {
-  uint32_t* mcast_dst = (uint32_t *)snrt_remote_l1_ptr((void*) buffer_dst,
-                                                 snrt_cluster_idx(), snrt_cluster_idx() + cluster_offset);
+void issue_dma_mcast(uint32_t *buffer_src, uint32_t *buffer_dst, pb_mcast_t mcast) {
+  uint32_t* mcast_dst = (uint32_t *)pb_mcast_addr((void*) buffer_dst, mcast);
   uint32_t* mcast_src = buffer_src;
-  dma_broadcast_to_clusters(mcast_dst, mcast_src, LENGTH * sizeof(uint32_t), mcast_mask);
+  dma_broadcast_to_clusters(mcast_dst, mcast_src, LENGTH * sizeof(uint32_t), mcast.mask);
 }
 
 
 // Function to issue multicast request over the full row
 void issue_mcast_row(uint32_t *buffer_src, uint32_t *buffer_dst) {
-  issue_dma_mcast(buffer_src, buffer_dst, 4, ROW_MASK);
+  issue_dma_mcast(buffer_src, buffer_dst, pb_mcast_row(pb_cluster_row()));
 }
 
 // Function to issue multicast request over the full column
 void issue_mcast_column(uint32_t *buffer_src, uint32_t *buffer_dst) {
-  issue_dma_mcast(buffer_src, buffer_dst, 1, COLUMN_MASK);
+  issue_dma_mcast(buffer_src, buffer_dst, pb_mcast_col(pb_cluster_col()));
 }
 
 
@@ -30,6 +30,10 @@ SN_RUNTIME_INCDIRS   = $(PB_INCDIR)
 SN_RUNTIME_INCDIRS  += $(PB_GEN_DIR)
 SN_RUNTIME_HAL_HDRS  = $(PB_GEN_DIR)/pb_addrmap.h
 SN_RUNTIME_HAL_HDRS += $(PB_GEN_DIR)/pb_raw_addrmap.h
+SN_RUNTIME_HAL_HDRS += $(PB_GEN_DIR)/pb_noc_cfg.h
+SN_RUNTIME_HAL_HDRS += $(PB_GEN_DIR)/pb_cluster_cfg.h
+SN_RUNTIME_HAL_HDRS += $(PB_GEN_DIR)/pb_l2_cfg.h
+SN_RUNTIME_HAL_HDRS += $(PB_GEN_DIR)/pb_l2_cfg.ld
 SN_BUILD_APPS        = OFF
 
 SN_APPS  = $(PB_SNITCH_SW_DIR)/apps/gemm_2d
@@ -44,6 +48,24 @@ include $(SN_ROOT)/make/sw.mk
 $(PB_GEN_DIR)/pb_raw_addrmap.h: $(PB_RDL_ALL)
 	$(PEAKRDL) raw-header $< -o $@ $(PEAKRDL_INCLUDES) $(PEAKRDL_DEFINES) --base_name $(notdir $(basename $@)) --format c
 
+PB_GEN_NOC_CFG_PY = $(PB_SNITCH_SW_DIR)/runtime/scripts/gen_noc_cfg.py
+
+$(PB_GEN_DIR)/pb_noc_cfg.h: $(FLOO_CFG) $(PB_GEN_NOC_CFG_PY)
+	$(PB_GEN_NOC_CFG_PY) -c $(FLOO_CFG) -o $@
+
+PB_GEN_CLUSTER_CFG_PY = $(PB_SNITCH_SW_DIR)/runtime/scripts/gen_cluster_cfg.py
+
+$(PB_GEN_DIR)/pb_cluster_cfg.h: $(SN_CFG) $(PB_GEN_CLUSTER_CFG_PY)
+	$(PB_GEN_CLUSTER_CFG_PY) -c $(SN_CFG) -o $@
+
+# The interleaved L2 window is configured together with the hardware. The
+# linker script fragment is included by `memory.ld`.
+$(PB_GEN_DIR)/pb_l2_cfg.h $(PB_GEN_DIR)/pb_l2_cfg.ld: $(L2_CFG) $(PB_GEN_L2_CFG_PY)
+	$(PB_GEN_L2_CFG_PY) -c $(L2_CFG) -o $@
+
+SN_RISCV_LDFLAGS       += -L$(PB_GEN_DIR)
+SN_TESTS_RISCV_LDFLAGS += -L$(PB_GEN_DIR)
+
 # Collect Snitch tests which should be built
 PB_SN_TESTS_DIR      = $(PB_SNITCH_SW_DIR)/tests
 PB_SN_TESTS_BUILDDIR = $(PB_SNITCH_SW_DIR)/tests/build
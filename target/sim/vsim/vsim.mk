@@ -13,6 +13,7 @@ VLOG_ARGS += -suppress vlog-2583
 VLOG_ARGS += -suppress vlog-13314
 VLOG_ARGS += -suppress vlog-13233
 VLOG_ARGS += -timescale 1ns/1ps
+VLOG_ARGS += +define+PB_NOC_PERF_EN
 
 VSIM_FLAGS = -work $(VSIM_WORK)
 VSIM_FLAGS += -suppress 3009
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generate the configuration of the interleaved L2 window from a single
+# configuration file, for the hardware and the software:
+#
+# - `*.sv`: SystemVerilog package, imported by `picobello_pkg`
+# - `*.h`:  C header of the Snitch runtime
+# - `*.ld`: linker script fragment, included by the Snitch `memory.ld`
+#
+# The output format is selected by the extension of the output file.
+
+import argparse
+import sys
+from pathlib import Path
+
+import json5
+
+LICENSE = """\
+Copyright 2025 ETH Zurich and University of Bologna.
+Licensed under the Apache License, Version 2.0, see LICENSE for details.
+SPDX-License-Identifier: Apache-2.0
+"""
+
+
+def comment(text, start, end=''):
+    return ''.join(f'{start} {line}{end}'.rstrip() + '\n' for line in text.splitlines())
+
+
+def emit_sv(cfg, cfg_name):
+    return f"""\
+{comment(LICENSE, '//')}//
+// Generated by gen_l2_interleave_cfg.py from {cfg_name}. Do not edit.
+
+package pb_l2_interleave_pkg;
+
+  localparam bit L2InterleaveEn = 1'b{cfg['enable']:d};
+  localparam longint unsigned L2InterleaveBase = 'h{cfg['base_addr']:x};
+  localparam int unsigned L2InterleaveBlockSize = {cfg['block_size']};
+  localparam int unsigned L2InterleaveTileSize = 'h{cfg['tile_size']:x};
+
+endpackage
+"""
+
+
+def emit_c(cfg, cfg_name):
+    return f"""\
+{comment(LICENSE, '//')}//
+// Generated by gen_l2_interleave_cfg.py from {cfg_name}. Do not edit.
+
+#pragma once
+
+// Interleaved L2 window
+#define PB_L2_INTERLEAVE_ENABLE {cfg['enable']:d}
+#define PB_L2_INTERLEAVE_BASE_ADDR {cfg['base_addr']:#x}
+#define PB_L2_INTERLEAVE_BLOCK_SIZE {cfg['block_size']}
+#define PB_L2_INTERLEAVE_TILE_SIZE {cfg['tile_size']:#x}
+"""
+
+
+def emit_ld(cfg, cfg_name):
+    return f"""\
+{comment(LICENSE, '/*', ' */')}
+/* Generated by gen_l2_interleave_cfg.py from {cfg_name}. Do not edit. */
+
+PB_L2_INTERLEAVE_ENABLE = {cfg['enable']:d};
+PB_L2_INTERLEAVE_TILE_SIZE = {cfg['tile_size']:#x};
+"""
+
+
+EMITTERS = {'.sv': emit_sv, '.h': emit_c, '.ld': emit_ld}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the interleaved L2 window configuration')
+    parser.add_argument('-c', '--cfg', type=Path, required=True,
+                        help='Interleaved L2 window configuration file')
+    parser.add_argument('-o', '--output', type=Path, required=True,
+                        help='Output file, one of *.sv, *.h or *.ld')
+    args = parser.parse_args()
+    if args.output.suffix not in EMITTERS:
+        parser.error(f'unsupported output format: {args.output.suffix}')
+    with open(args.cfg) as f:
+        cfg = json5.load(f)
+    if cfg['block_size'] < 4096 or cfg['block_size'] & (cfg['block_size'] - 1):
+        parser.error('block_size must be a power of two of at least 4 KiB')
+    out = EMITTERS[args.output.suffix](cfg, args.cfg.name)
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text(out)
+
+
+if __name__ == '__main__':
+    sys.exit(main())